@@ -0,0 +1,53 @@
+#type vertex
+#version 450 core
+
+// Per instance (one instance per circle)
+layout(location = 0) in vec3 a_Position;
+layout(location = 1) in vec4 a_Transform;
+layout(location = 2) in vec4 a_Color;
+layout(location = 3) in float a_Thickness;
+
+uniform mat4 u_ViewProjMatrix;
+
+flat out vec4 v_Color;
+flat out float v_Thickness;
+out vec2 v_LocalPosition;
+
+void main()
+{
+	// Drawn as a 4 vertex triangle strip: (-0.5, -0.5), (0.5, -0.5), (-0.5, 0.5), (0.5, 0.5)
+	vec2 corner = vec2(float(gl_VertexID & 1), float(gl_VertexID >> 1)) - 0.5;
+
+	vec3 position = a_Position;
+	position.xy += a_Transform.xy * corner.x + a_Transform.zw * corner.y;
+	gl_Position = u_ViewProjMatrix * vec4(position, 1.0);
+
+	v_Color = a_Color;
+	v_Thickness = a_Thickness;
+	v_LocalPosition = corner * 2.0;
+}
+
+#type fragment
+#version 450 core
+
+layout(location = 0) out vec4 o_Color;
+
+flat in vec4 v_Color;
+flat in float v_Thickness;
+in vec2 v_LocalPosition;
+
+void main()
+{
+	// Distance from the center, 1 being on the outline
+	float distance = length(v_LocalPosition);
+	float width = fwidth(distance);
+
+	float alpha = 1.0 - smoothstep(1.0 - width, 1.0, distance);
+	if (v_Thickness < 1.0)
+		alpha *= smoothstep(1.0 - v_Thickness - width, 1.0 - v_Thickness, distance);
+
+	o_Color = v_Color;
+	o_Color.a *= alpha;
+
+	if (o_Color.a == 0.0) discard;
+}
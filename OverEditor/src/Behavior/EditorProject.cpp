@@ -56,7 +56,8 @@ namespace OverEditor
 		m_Name = projectNode["Name"].as<String>();
 		m_AssetsDirectoryPath = m_RootPath + "/" + projectNode["AssetsRoot"].as<String>();
 
-		AssetDatabase::Init(m_AssetsDirectoryPath);
+		// Generated files stay out of the assets, next to them in the project
+		AssetDatabase::Init(m_AssetsDirectoryPath, m_RootPath + "/Cache");
 		AssetDatabase::Refresh();
 	}
 
@@ -149,15 +149,7 @@ namespace OverEditor
 			m_ViewportPanel.OnImGuiRender();
 			m_SceneHierarchyPanel.OnImGuiRender();
 			m_AssetsPanel.OnImGuiRender();
-
-			ImGui::Begin("Renderer2D");
-			ImGui::Columns(2);
-			ImGui::TextUnformatted(Renderer2D::GetShader()->GetName().c_str());
-			ImGui::NextColumn();
-			if (ImGui::Button("Reload"))
-				Renderer2D::GetShader()->Reload();
-			ImGui::Columns(1);
-			ImGui::End();
+			m_RendererStatisticsPanel.OnImGuiRender();
 		}
 	}
 
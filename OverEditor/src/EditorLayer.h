@@ -12,6 +12,7 @@
 #include "UI/Panels/ViewportPanel.h"
 #include "UI/Panels/SceneHierarchyPanel.h"
 #include "UI/Panels/AssetsPanel.h"
+#include "UI/Panels/RendererStatisticsPanel.h"
 
 namespace OverEditor
 {
@@ -52,6 +53,7 @@ namespace OverEditor
 		ViewportPanel m_ViewportPanel;
 		SceneHierarchyPanel m_SceneHierarchyPanel;
 		AssetsPanel m_AssetsPanel;
+		RendererStatisticsPanel m_RendererStatisticsPanel;
 
 		bool m_IsProjectManagerOpen = true;
 	};
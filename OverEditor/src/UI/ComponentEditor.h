@@ -2,7 +2,12 @@
 
 #include <OverEngine/ImGui/UIElements.h>
 #include <OverEngine/Scene/Components.h>
+#include <OverEngine/Scene/TilemapComponent.h>
+#include <OverEngine/Scene/ParticleEmitter2DComponent.h>
+#include <OverEngine/Scene/SpriteAnimatorComponent.h>
+#include <OverEngine/Scene/Scene.h>
 #include <OverEngine/Core/Runtime/Reflection/TypeInfo.h>
+#include <OverEngine/ImGui/ExtraImGui.h>
 #include <imgui/imgui.h>
 
 #define ECS_ACTION_FUNCS(T, setter, getter)       \
@@ -40,9 +45,8 @@
 
 namespace OverEditor
 {
-	// Base
 	template<typename T>
-	void ComponentEditor(Entity entity, uint32_t typeID)
+	void ReflectedPropertiesEditor(Entity entity)
 	{
 		UIElements::BeginFieldGroup();
 
@@ -53,6 +57,13 @@ namespace OverEditor
 		}
 
 		UIElements::EndFieldGroup();
+	}
+
+	// Base
+	template<typename T>
+	void ComponentEditor(Entity entity, uint32_t typeID)
+	{
+		ReflectedPropertiesEditor<T>(entity);
 
 #if 0
 		if (UIElements::BeginComponentEditor<T>(entity, entity.GetComponent<T>().GetName(), typeID))
@@ -94,10 +105,222 @@ namespace OverEditor
 				ECS_FLAG_ACTION_VALUE(CameraComponent, ClearFlags_ClearDepth, Camera.GetClearFlags())
 			);
 
+			static UIElements::EnumValues layerValues;
+			if (layerValues.empty())
+			{
+				for (uint32_t layer = 0; layer < RenderLayerCount; layer++)
+					layerValues[(int)(1u << layer)] = fmt::format("Layer {}", layer);
+			}
+
+			UIElements::BasicEnum_U("Culling Mask", layerValues, true,
+				ECS_ACTION_VALUE(CameraComponent, CullingMask)
+			);
+
 			UIElements::EndFieldGroup();
 		}
 	}
 
+	template<>
+	void ComponentEditor<SpriteRendererComponent>(Entity entity, uint32_t typeID)
+	{
+		SpriteRendererComponent old = entity.GetComponent<SpriteRendererComponent>();
+
+		ReflectedPropertiesEditor<SpriteRendererComponent>(entity);
+
+		// Static sprites are only rebuilt on request
+		const auto& sp = entity.GetComponent<SpriteRendererComponent>();
+		if (sp.Enabled != old.Enabled || sp.Tint != old.Tint || sp.Sprite != old.Sprite || sp.Tiling != old.Tiling ||
+			sp.Offset != old.Offset || sp.Flip != old.Flip || sp.ForceTile != old.ForceTile || sp.Static != old.Static || sp.Layer != old.Layer)
+		{
+			entity.GetScene()->InvalidateSprite(entity);
+		}
+	}
+
+	template<>
+	void ComponentEditor<SpriteAnimatorComponent>(Entity entity, uint32_t typeID)
+	{
+		ReflectedPropertiesEditor<SpriteAnimatorComponent>(entity);
+
+		auto& sa = entity.GetComponent<SpriteAnimatorComponent>();
+		sa.Columns = std::max(sa.Columns, 1u);
+		sa.Rows = std::max(sa.Rows, 1u);
+
+		if (!ImGui::TreeNodeEx("Animations", ImGuiTreeNodeFlags_SpanAvailWidth | ImGuiTreeNodeFlags_DefaultOpen))
+			return;
+
+		for (uint32_t i = 0; i < (uint32_t)sa.Animations.size();)
+		{
+			auto& animation = sa.Animations[i];
+			ImGui::PushID(i);
+
+			if (ImGui::Button("X"))
+			{
+				sa.Animations.erase(sa.Animations.begin() + i);
+				ImGui::PopID();
+				continue;
+			}
+
+			ImGui::SameLine();
+			if (ImGui::RadioButton("##Current", sa.GetAnimation() == i))
+				sa.Play(i);
+
+			ImGui::SameLine();
+			ImGui::InputText("##Name", &animation.Name);
+
+			UIElements::BeginFieldGroup();
+			UIElements::DragFloatField("FrameRate", &animation.FrameRate, 0.5f, 0.0f, FLT_MAX);
+			UIElements::CheckboxField("Looping", &animation.Looping);
+
+			// Sheet frames separated by spaces or commas
+			std::string frames;
+			for (uint32_t frame : animation.Frames)
+				frames += fmt::format("{} ", frame);
+
+			if (ImGui::InputText("Frames", &frames))
+			{
+				animation.Frames.clear();
+				std::replace(frames.begin(), frames.end(), ',', ' ');
+
+				std::istringstream stream(frames);
+				for (uint32_t frame; stream >> frame;)
+					animation.Frames.push_back(frame);
+			}
+			UIElements::EndFieldGroup();
+
+			ImGui::PopID();
+			i++;
+		}
+
+		if (ImGui::Button("Add Animation"))
+		{
+			auto& animation = sa.Animations.emplace_back();
+			animation.Name = fmt::format("Animation {}", sa.Animations.size());
+			for (uint32_t frame = 0; frame < sa.Columns * sa.Rows; frame++)
+				animation.Frames.push_back(frame);
+		}
+
+		ImGui::TreePop();
+	}
+
+	template<>
+	void ComponentEditor<TilemapComponent>(Entity entity, uint32_t typeID)
+	{
+		// Not copying the whole component, the tiles don't change here
+		const auto& tm = entity.GetComponent<TilemapComponent>();
+		Ref<Texture2D> tileSet = tm.TileSet;
+		uint32_t columns = tm.Columns, rows = tm.Rows;
+		Vector2 cellSize = tm.CellSize;
+		Color tint = tm.Tint;
+
+		ReflectedPropertiesEditor<TilemapComponent>(entity);
+
+		// Tiles are painted from the viewport, see ViewportPanel
+		auto& edited = entity.GetComponent<TilemapComponent>();
+		edited.Columns = std::max(edited.Columns, 1u);
+		edited.Rows = std::max(edited.Rows, 1u);
+
+		if (edited.TileSet != tileSet || edited.Columns != columns || edited.Rows != rows || edited.CellSize != cellSize || edited.Tint != tint)
+			edited.Invalidate();
+
+		ImGui::Text("Chunks: %u", (uint32_t)edited.GetChunks().size());
+	}
+
+	// Keys in a tree node, kept sorted by time
+	template<typename T>
+	void LifetimeCurveEditor(const char* name, LifetimeCurve<T>& curve)
+	{
+		if (!ImGui::TreeNodeEx(name, ImGuiTreeNodeFlags_SpanAvailWidth))
+			return;
+
+		// Edited on a copy, setting the keys keeps the curve's hash in sync
+		auto keys = curve.GetKeys();
+		bool changed = false;
+		for (auto it = keys.begin(); it != keys.end();)
+		{
+			ImGui::PushID(&(*it));
+
+			if (ImGui::Button("X"))
+			{
+				it = keys.erase(it);
+				changed = true;
+				ImGui::PopID();
+				continue;
+			}
+
+			UIElements::BeginFieldGroup();
+			changed |= UIElements::DragFloatField("Time", &it->Time, 0.01f, 0.0f, 1.0f);
+
+			if constexpr (std::is_same_v<T, Color>)
+				changed |= UIElements::Color4Field("Value", glm::value_ptr(it->Value));
+			else
+				changed |= UIElements::DragFloatField("Value", &it->Value, 0.01f);
+			UIElements::EndFieldGroup();
+
+			ImGui::PopID();
+			it++;
+		}
+
+		if (ImGui::Button("Add Key"))
+		{
+			keys.push_back({ 1.0f, curve.Evaluate(1.0f) });
+			changed = true;
+		}
+
+		if (changed)
+			curve.SetKeys(std::move(keys));
+
+		ImGui::TreePop();
+	}
+
+	template<>
+	void ComponentEditor<ParticleEmitter2DComponent>(Entity entity, uint32_t typeID)
+	{
+		ReflectedPropertiesEditor<ParticleEmitter2DComponent>(entity);
+
+		auto& pe = entity.GetComponent<ParticleEmitter2DComponent>();
+		pe.Layer = (uint8_t)std::min((uint32_t)pe.Layer, RenderLayerCount - 1);
+
+		if (ImGui::TreeNodeEx("Bursts", ImGuiTreeNodeFlags_SpanAvailWidth))
+		{
+			for (auto it = pe.Bursts.begin(); it != pe.Bursts.end();)
+			{
+				ImGui::PushID(&(*it));
+
+				if (ImGui::Button("X"))
+				{
+					it = pe.Bursts.erase(it);
+					ImGui::PopID();
+					continue;
+				}
+
+				UIElements::BeginFieldGroup();
+				UIElements::DragFloatField("Time", &it->Time, 0.05f, 0.0f, pe.Duration);
+
+				int count = (int)it->Count;
+				if (ImGui::DragInt("Count", &count, 1.0f, 0, INT_MAX))
+					it->Count = (uint32_t)std::max(count, 0);
+				UIElements::EndFieldGroup();
+
+				ImGui::PopID();
+				it++;
+			}
+
+			if (ImGui::Button("Add Burst"))
+				pe.Bursts.emplace_back();
+
+			ImGui::TreePop();
+		}
+
+		LifetimeCurveEditor("Color Over Lifetime", pe.ColorOverLifetime);
+		LifetimeCurveEditor("Size Over Lifetime", pe.SizeOverLifetime);
+
+		if (ImGui::Button("Restart"))
+			pe.Restart();
+
+		ImGui::SameLine();
+		ImGui::Text("Particles: %u", pe.GetParticles().GetParticleCount());
+	}
+
 	template<>
 	void ComponentEditor<RigidBody2DComponent>(Entity entity, uint32_t typeID)
 	{
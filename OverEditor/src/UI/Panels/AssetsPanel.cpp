@@ -13,6 +13,12 @@ namespace OverEditor
 {
 	using namespace OverEngine;
 
+	// Small textures are loaded as SubTexture2D regions of an atlas page
+	static bool IsTextureAsset(const Ref<Asset>& asset)
+	{
+		return asset->GetClassName() == Texture2D::GetStaticClassName() || asset->GetClassName() == SubTexture2D::GetStaticClassName();
+	}
+
 	AssetsPanel::AssetsPanel()
 	{
 	}
@@ -169,7 +175,7 @@ namespace OverEditor
 			bool nodeIsOpen = ImGui::TreeNodeEx((void*)asset.get(), nodeFlags, asset->GetName().c_str());
 			ImGui::PopStyleVar();
 
-			if (asset->GetClassName() == Texture2D::GetStaticClassName())
+			if (IsTextureAsset(asset))
 			{
 				UIElements::Tooltip([&asset]() {
 					ImGui::TextUnformatted(asset->GetName().c_str());
@@ -212,7 +218,7 @@ namespace OverEditor
 		{
 			icon = EditorLayer::Get().GetIcons()["FolderIcon"];
 		}
-		else if (asset->GetClassName() == Texture2D::GetStaticClassName())
+		else if (IsTextureAsset(asset))
 		{
 			icon = std::dynamic_pointer_cast<Texture2D>(asset);
 		}
@@ -252,7 +258,7 @@ namespace OverEditor
 			ImGui::TextUnformatted(asset->GetName().c_str());
 		});
 
-		if (asset->GetClassName() == Texture2D::GetStaticClassName())
+		if (IsTextureAsset(asset))
 		{
 			UIElements::Texture2DDragSource(std::dynamic_pointer_cast<Texture2D>(asset), asset->GetName().c_str());
 		}
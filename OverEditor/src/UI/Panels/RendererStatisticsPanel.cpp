@@ -0,0 +1,74 @@
+#include "RendererStatisticsPanel.h"
+
+#include <imgui.h>
+
+namespace OverEditor
+{
+	void RendererStatisticsPanel::OnImGuiRender()
+	{
+		ImGui::Begin("Renderer2D");
+
+		ImGui::Columns(2);
+		ImGui::TextUnformatted(Renderer2D::GetShader()->GetName().c_str());
+		ImGui::NextColumn();
+		if (ImGui::Button("Reload"))
+			RenderCommand::Submit([]() { Renderer2D::GetShader()->Reload(); });
+		ImGui::Columns(1);
+
+		ImGui::Separator();
+
+		auto stats = Renderer2D::GetStatistics();
+
+		ImGui::Text("Quads: %u", stats.QuadCount);
+		ImGui::Text("Lines: %u", stats.LineCount);
+		ImGui::Text("Circles: %u", stats.CircleCount);
+		ImGui::Text("Vertices: %u", stats.VertexCount);
+		ImGui::Text("Draw Calls: %u", stats.DrawCalls);
+		ImGui::Text("Uploaded: %.1f KB", stats.BytesUploaded / 1024.0f);
+
+		ImGui::Separator();
+
+		ImGui::Text("CPU Submit: %.3f ms", stats.SubmitTime);
+		ImGui::Text("CPU Sort: %.3f ms", stats.SortTime);
+		ImGui::Text("GPU: %.3f ms", stats.GPUTime);
+
+		ImGui::Separator();
+
+		ImGui::Text("Batches: %u", (uint32_t)stats.Batches.size());
+		for (size_t i = 0; i < stats.BatchBreaks.size(); i++)
+		{
+			if (stats.BatchBreaks[i] > 0)
+				ImGui::BulletText("%s: %u", Renderer2D::GetBatchBreakReasonName((BatchBreakReason)i), stats.BatchBreaks[i]);
+		}
+
+		if (ImGui::TreeNode("Batch List"))
+		{
+			ImGui::Columns(5);
+			ImGui::TextUnformatted("Reason");    ImGui::NextColumn();
+			ImGui::TextUnformatted("Primitive"); ImGui::NextColumn();
+			ImGui::TextUnformatted("Count");     ImGui::NextColumn();
+			ImGui::TextUnformatted("Draws");     ImGui::NextColumn();
+			ImGui::TextUnformatted("GPU (ms)");  ImGui::NextColumn();
+			ImGui::Separator();
+
+			for (const auto& batch : stats.Batches)
+			{
+				ImGui::TextUnformatted(Renderer2D::GetBatchBreakReasonName(batch.Reason)); ImGui::NextColumn();
+				ImGui::TextUnformatted(Renderer2D::GetBatchPrimitiveName(batch.Primitive)); ImGui::NextColumn();
+				ImGui::Text("%u", batch.Count); ImGui::NextColumn();
+				ImGui::Text("%u", batch.DrawCalls); ImGui::NextColumn();
+
+				if (batch.GPUTime < 0.0f)
+					ImGui::TextUnformatted("-");
+				else
+					ImGui::Text("%.3f", batch.GPUTime);
+				ImGui::NextColumn();
+			}
+
+			ImGui::Columns(1);
+			ImGui::TreePop();
+		}
+
+		ImGui::End();
+	}
+}
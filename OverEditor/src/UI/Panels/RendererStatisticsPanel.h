@@ -0,0 +1,20 @@
+#pragma once
+
+#include <OverEngine.h>
+#include <OverEngine/ImGui/ImGuiPanel.h>
+
+namespace OverEditor
+{
+	using namespace OverEngine;
+
+	class RendererStatisticsPanel : public ImGuiPanel
+	{
+	public:
+		virtual void OnImGuiRender() override;
+
+		virtual void SetOpen(bool isOpen) override { m_IsOpen = isOpen; }
+		virtual bool IsOpen() override { return m_IsOpen; }
+	private:
+		bool m_IsOpen = true;
+	};
+}
@@ -110,6 +110,9 @@ namespace OverEditor
 			{
 				CheckComponentEditor<TransformComponent>(componentTypeID, selectedEntity);
 				CheckComponentEditor<SpriteRendererComponent>(componentTypeID, selectedEntity);
+				CheckComponentEditor<SpriteAnimatorComponent>(componentTypeID, selectedEntity);
+				CheckComponentEditor<TilemapComponent>(componentTypeID, selectedEntity);
+				CheckComponentEditor<ParticleEmitter2DComponent>(componentTypeID, selectedEntity);
 				CheckComponentEditor<CameraComponent>(componentTypeID, selectedEntity);
 				CheckComponentEditor<RigidBody2DComponent>(componentTypeID, selectedEntity);
 				CheckComponentEditor<Colliders2DComponent>(componentTypeID, selectedEntity);
@@ -123,6 +126,9 @@ namespace OverEditor
 			{
 				CheckAddComponent<TransformComponent>(selectedEntity, "Transform##AddComponentPopup");
 				CheckAddComponent<SpriteRendererComponent>(selectedEntity, "SpriteRenderer##AddComponentPopup", nullptr);
+				CheckAddComponent<SpriteAnimatorComponent>(selectedEntity, "SpriteAnimator##AddComponentPopup");
+				CheckAddComponent<TilemapComponent>(selectedEntity, "Tilemap##AddComponentPopup");
+				CheckAddComponent<ParticleEmitter2DComponent>(selectedEntity, "ParticleEmitter2D##AddComponentPopup");
 				CheckAddComponent<CameraComponent>(selectedEntity, "Camera##AddComponentPopup");
 				CheckAddComponent<RigidBody2DComponent>(selectedEntity, "RigidBody2D##AddComponentPopup");
 				CheckAddComponent<Colliders2DComponent>(selectedEntity, "Colliders2D##AddComponentPopup");
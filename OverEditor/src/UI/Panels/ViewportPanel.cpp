@@ -101,6 +101,21 @@ namespace OverEditor
 
 			if (ImGui::Button("Reload Grid Shader"))
 				s_Data->GridShader->Reload();
+
+			if (m_Context->Selection && m_Context->Selection->HasComponent<TilemapComponent>())
+			{
+				ImGui::Separator();
+
+				bool painting = m_Tool == ViewportTool::PaintTiles;
+				if (ImGui::Checkbox("Paint Tiles", &painting))
+					m_Tool = painting ? ViewportTool::PaintTiles : ViewportTool::Translate2D;
+
+				DrawTilePalette(m_Context->Selection->GetComponent<TilemapComponent>());
+			}
+			else if (m_Tool == ViewportTool::PaintTiles)
+			{
+				m_Tool = ViewportTool::Translate2D;
+			}
 		}
 		ImGui::End();
 
@@ -158,6 +173,9 @@ namespace OverEditor
 				// Gizmo
 				DrawGizmo(entityTransform, hovered);
 
+				if (m_Tool == ViewportTool::PaintTiles && !m_Panning && m_Context->Selection->HasComponent<TilemapComponent>())
+					PaintTiles(m_Context->Selection->GetComponent<TilemapComponent>(), entityTransform, hovered);
+
 				// Focus
 				if (hovered && fDown && !m_FDownLastFrame)
 					m_CameraTransform.SetPosition(entityTransform.GetPosition());
@@ -219,7 +237,8 @@ namespace OverEditor
 				m_PanelSize.x > 0.0f && m_PanelSize.y > 0.0f && // zero sized framebuffer is invalid
 				(props.Width != m_PanelSize.x || props.Height != m_PanelSize.y))
 			{
-				m_FrameBuffer->Resize((uint32_t)m_PanelSize.x, (uint32_t)m_PanelSize.y);
+				// Applied at the end of the frame, only once however many times the panel changed size
+				FrameBufferPool::RequestResize(m_FrameBuffer, (uint32_t)m_PanelSize.x, (uint32_t)m_PanelSize.y);
 			}
 		}
 
@@ -231,11 +250,17 @@ namespace OverEditor
 
 			if (m_Context->RuntimeFlags & SceneEditor::RuntimeFlags_Simulating
 				&& !(m_Context->RuntimeFlags & SceneEditor::RuntimeFlags_SimulationPaused))
+			{
 				scene->OnPhysicsUpdate(Time::GetDeltaTime());
+				scene->OnAnimationsUpdate(Time::GetDeltaTime());
+				scene->OnParticlesUpdate(Time::GetDeltaTime());
+			}
 
 			if (m_Context->RuntimeFlags & SceneEditor::RuntimeFlags_SimulationStepNextFrame)
 			{
 				scene->OnPhysicsUpdate(Time::GetDeltaTime());
+				scene->OnAnimationsUpdate(Time::GetDeltaTime());
+				scene->OnParticlesUpdate(Time::GetDeltaTime());
 				m_Context->RuntimeFlags ^= SceneEditor::RuntimeFlags_SimulationStepNextFrame;
 			}
 
@@ -244,9 +269,20 @@ namespace OverEditor
 			DrawGrid();
 			RenderCommand::Clear(ClearFlags_ClearDepth);
 
-			Renderer2D::BeginScene(glm::inverse(m_CameraTransform.GetMatrix()), m_Camera);
-			scene->RenderSprites();
+			Mat4x4 viewMatrix = glm::inverse(m_CameraTransform.GetMatrix());
+			scene->ExtractSprites();
+			Renderer2D::BeginScene(viewMatrix, m_Camera);
+			scene->RenderSprites(m_Camera.GetProjection() * viewMatrix);
 			Renderer2D::EndScene();
+
+			// Drawn over the sprites
+			if (m_Context->Selection)
+			{
+				RenderCommand::Clear(ClearFlags_ClearDepth);
+				Renderer2D::BeginScene(viewMatrix, m_Camera, false);
+				DrawSelection(*m_Context->Selection);
+				Renderer2D::EndScene();
+			}
 		}
 		else
 		{
@@ -407,6 +443,120 @@ namespace OverEditor
 		}
 	}
 
+	Vector2 ViewportPanel::GetMouseWorldPosition()
+	{
+		auto mousePos = ImGui::GetMousePos();
+		auto winPos = ImGui::GetWindowPos();
+
+		Vector2 n;
+		n.x =  ((mousePos.x - (winPos.x + m_PanelPos.x)) / m_PanelSize.x - 0.5f) * 2;
+		n.y = -((mousePos.y - (winPos.y + m_PanelPos.y)) / m_PanelSize.y - 0.5f) * 2;
+
+		Mat4x4 viewProjInverse = glm::inverse(m_Camera.GetProjection() * glm::inverse(m_CameraTransform.GetMatrix()));
+		Vector4 position = viewProjInverse * Vector4(n.x, n.y, 0.0f, 1.0f);
+		return Vector2(position) / position.w;
+	}
+
+	void ViewportPanel::DrawTilePalette(const TilemapComponent& tilemap)
+	{
+		if (ImGui::RadioButton("Erase", m_TileBrush == TilemapComponent::EmptyTile))
+			m_TileBrush = TilemapComponent::EmptyTile;
+
+		if (!tilemap.TileSet)
+			return;
+
+		// UVs of the whole tile set, it may be a part of an atlas
+		Rect rect = { 0.0f, 0.0f, 1.0f, 1.0f };
+		if (tilemap.TileSet->GetType() == TextureType::SubTexture)
+			rect = std::static_pointer_cast<SubTexture2D>(tilemap.TileSet)->GetRect();
+
+		void* textureID = reinterpret_cast<void*>((ptrdiff_t)tilemap.TileSet->GetRendererID());
+		Vector2 tileSize = { rect.z / tilemap.Columns, rect.w / tilemap.Rows };
+
+		uint32_t tileCount = std::min(tilemap.GetTileCount(), (uint32_t)UINT16_MAX);
+		float available = ImGui::GetContentRegionAvail().x;
+		float x = 0.0f;
+
+		for (uint32_t index = 0; index < tileCount; index++)
+		{
+			uint32_t column = index % tilemap.Columns;
+			uint32_t row = index / tilemap.Columns;
+			ImVec2 uv0 = { rect.x + column * tileSize.x, rect.y + row * tileSize.y };
+			ImVec2 uv1 = { uv0.x + tileSize.x, uv0.y + tileSize.y };
+
+			uint16_t tile = (uint16_t)(index + 1);
+			ImVec4 background = m_TileBrush == tile ? ImGui::GetStyleColorVec4(ImGuiCol_ButtonActive) : ImVec4(0, 0, 0, 0);
+
+			ImGui::PushID((int)index);
+			if (ImGui::ImageButton(textureID, { 32, 32 }, uv0, uv1, 2, background))
+				m_TileBrush = tile;
+			ImGui::PopID();
+
+			x += ImGui::GetItemRectSize().x + ImGui::GetStyle().ItemSpacing.x;
+			if (x + ImGui::GetItemRectSize().x < available)
+				ImGui::SameLine();
+			else
+				x = 0.0f;
+		}
+	}
+
+	void ViewportPanel::PaintTiles(TilemapComponent& tilemap, const TransformComponent& transform, bool hovered)
+	{
+		if (!hovered || !ImGui::IsMouseDown(ImGuiMouseButton_Left))
+			return;
+
+		auto cell = tilemap.WorldToCell(transform.GetLocalToWorld(), GetMouseWorldPosition());
+		tilemap.SetTile(cell.x, cell.y, m_TileBrush);
+	}
+
+	void ViewportPanel::DrawSelection(Entity selection)
+	{
+		static const Color outlineColor = { 1.0f, 0.6f, 0.1f, 1.0f };
+		static const Color colliderColor = { 0.3f, 1.0f, 0.4f, 1.0f };
+
+		const Mat4x4& localToWorld = selection.GetComponent<TransformComponent>().GetLocalToWorld();
+
+		if (selection.HasComponent<SpriteRendererComponent>())
+			Renderer2D::DrawRect(localToWorld, outlineColor);
+
+		if (!selection.HasComponent<Colliders2DComponent>())
+			return;
+
+		for (const auto& collider : selection.GetComponent<Colliders2DComponent>().Colliders)
+		{
+			const auto& props = collider->GetProps();
+			if (!props.Shape)
+				continue;
+
+			Mat4x4 transform = localToWorld;
+			if (props.AttachedEntity && props.AttachedEntity != selection)
+				transform = props.AttachedEntity.GetComponent<TransformComponent>().GetLocalToWorld();
+
+			transform = glm::translate(transform, Vector3(props.Shape->GetOffset(), 0.0f));
+
+			switch (props.Shape->GetType())
+			{
+			case CollisionShape2DType::Box:
+			{
+				auto box = std::static_pointer_cast<BoxCollisionShape2D>(props.Shape);
+				transform = glm::rotate(transform, box->GetRotation(), Vector3(0.0f, 0.0f, 1.0f));
+				transform = glm::scale(transform, Vector3(box->GetSize(), 1.0f));
+				Renderer2D::DrawRect(transform, colliderColor);
+				break;
+			}
+			case CollisionShape2DType::Circle:
+			{
+				// Box2D doesn't scale circles either
+				auto circle = std::static_pointer_cast<CircleCollisionShape2D>(props.Shape);
+				Renderer2D::DrawCircle(Vector3(transform[3]), circle->GetRadius(), colliderColor, 0.05f);
+				break;
+			}
+			default:
+				break;
+			}
+		}
+	}
+
 	void ViewportPanel::DrawGrid()
 	{
 		s_Data->GridShader->Bind();
@@ -10,7 +10,7 @@ namespace OverEditor
 
 	enum class ViewportTool
 	{
-		None, Translate2D
+		None, Translate2D, PaintTiles
 	};
 
 	class ViewportPanel : public ImGuiPanel
@@ -37,7 +37,15 @@ namespace OverEditor
 		float ClosestDistanceBetweenLines(ViewportRay& l1, ViewportRay& l2);
 		void DrawGizmo(TransformComponent& entityTransform, bool hovered);
 
+		// Mouse position on the XY plane
+		Vector2 GetMouseWorldPosition();
+		void DrawTilePalette(const TilemapComponent& tilemap);
+		void PaintTiles(TilemapComponent& tilemap, const TransformComponent& transform, bool hovered);
+
 		void DrawGrid();
+
+		// Outlines of the selected entity's sprite and colliders
+		void DrawSelection(Entity selection);
 	private:
 		bool m_IsOpen;
 
@@ -60,5 +68,8 @@ namespace OverEditor
 		Axis m_HoveredTranslateAxis = Axis::None;
 		Axis m_ActiveTranslateAxis = Axis::None;
 		Vector3 m_Translate2DToolLastIntersect = { 0.0f, 0.0f, 0.0f };
+
+		// Tile set by the PaintTiles tool, TilemapComponent::EmptyTile erases
+		uint16_t m_TileBrush = 1;
 	};
 }
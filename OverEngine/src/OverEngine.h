@@ -24,18 +24,28 @@
 #include "OverEngine/Scene/ScriptableEntity.h"
 #include "OverEngine/Scene/Components.h"
 #include "OverEngine/Scene/TransformComponent.h"
+#include "OverEngine/Scene/TilemapComponent.h"
+#include "OverEngine/Scene/ParticleEmitter2DComponent.h"
+#include "OverEngine/Scene/SpriteAnimatorComponent.h"
 // -----------------------------------
 
 // ------- Renderer ------------------
 #include "OverEngine/Renderer/Renderer.h"
 #include "OverEngine/Renderer/Renderer2D.h"
+#include "OverEngine/Renderer/RenderThread.h"
+#include "OverEngine/Renderer/RenderCommandQueue.h"
 #include "OverEngine/Renderer/ParticleSystem2D.h"
+#include "OverEngine/Renderer/GPUParticleSystem2D.h"
 
 #include "OverEngine/Renderer/VertexArray.h"
 #include "OverEngine/Renderer/Buffer.h"
 #include "OverEngine/Renderer/Shader.h"
 #include "OverEngine/Renderer/Texture.h"
+#include "OverEngine/Renderer/TextureRegistry.h"
+#include "OverEngine/Renderer/Font.h"
 #include "OverEngine/Renderer/FrameBuffer.h"
+#include "OverEngine/Renderer/FrameBufferPool.h"
+#include "OverEngine/Renderer/TimerQuery.h"
 #include "OverEngine/Renderer/Camera.h"
 // -----------------------------------
 
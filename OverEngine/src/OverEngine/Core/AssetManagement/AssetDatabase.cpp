@@ -5,6 +5,7 @@
 #include <OverEngine/Scene/SceneSerializer.h>
 
 #include <OverEngine/Renderer/Texture.h>
+#include <OverEngine/Renderer/TextureAtlas.h>
 
 #include <yaml-cpp/yaml.h>
 #include <filesystem>
@@ -14,16 +15,77 @@ namespace OverEngine
 	UnorderedMap<uint64_t, Ref<Asset>> AssetDatabase::s_Registry;
 	Ref<AssetFolder> AssetDatabase::s_Root = nullptr;
 
+	static constexpr const char* TextureAtlasCacheFileName = "TextureAtlas.cache";
+
+	// Optional `Filter`, `UWrap` and `VWrap` of a texture's metadata
+	struct TextureSampling
+	{
+		std::optional<TextureFilter> Filter;
+		std::optional<TextureWrap> UWrap, VWrap;
+
+		// Atlas pages are filtered bilinearly and regions are padded with their edge texels,
+		// any other sampling needs a texture of its own
+		bool FitsAtlas() const
+		{
+			return (!Filter || *Filter == TextureFilter::BiLinear) &&
+				(!UWrap || *UWrap == TextureWrap::Clamp) && (!VWrap || *VWrap == TextureWrap::Clamp);
+		}
+
+		void Apply(const Ref<Texture2D>& texture) const
+		{
+			if (Filter) texture->SetFilter(*Filter);
+			if (UWrap) texture->SetUWrap(*UWrap);
+			if (VWrap) texture->SetVWrap(*VWrap);
+		}
+	};
+
+	static std::optional<TextureFilter> ReadTextureFilter(const YAML::Node& node)
+	{
+		if (!node)
+			return std::nullopt;
+
+		String value = node.as<String>();
+		if (value == "Nearest")  return TextureFilter::Nearest;
+		if (value == "BiLinear") return TextureFilter::BiLinear;
+
+		OE_THROW("Unknown texture filter '{}'", value);
+		return std::nullopt;
+	}
+
+	static std::optional<TextureWrap> ReadTextureWrap(const YAML::Node& node)
+	{
+		if (!node)
+			return std::nullopt;
+
+		String value = node.as<String>();
+		if (value == "Repeat") return TextureWrap::Repeat;
+		if (value == "Clamp")  return TextureWrap::Clamp;
+		if (value == "Mirror") return TextureWrap::Mirror;
+
+		OE_THROW("Unknown texture wrap '{}'", value);
+		return std::nullopt;
+	}
+
 	void AssetDatabase::Init()
 	{
 		s_Root = CreateRef<AssetFolder>();
 	}
 
-	bool AssetDatabase::Init(const String& assetDirectoryPath)
+	bool AssetDatabase::Init(const String& assetDirectoryPath, const String& cacheDirectoryPath)
 	{
 		s_Root = CreateRef<AssetFolder>();
 		String correctedAssetDirectoryPath = std::filesystem::path(assetDirectoryPath).string();
 
+		struct MetadataFile
+		{
+			String Path;
+			String AssetPath;
+			YAML::Node Node;
+			TextureSampling Sampling;
+		};
+
+		Vector<MetadataFile> metadataFiles;
+
 		for (auto entry : std::filesystem::recursive_directory_iterator(correctedAssetDirectoryPath))
 		{
 			String stringPath = entry.path().string();
@@ -38,8 +100,68 @@ namespace OverEngine
 			{
 				try
 				{
-					YAML::Node metaData = YAML::LoadFile(stringPath);
-					String typeStr = metaData["Type"].as<String>();
+					auto& file = metadataFiles.emplace_back();
+					file.Path = stringPath;
+					file.AssetPath = stringPath.substr(0, stringPath.size() - 1 - strlen(Extensions::AssetMetadataFileExtension));
+					file.Node = YAML::LoadFile(stringPath);
+				}
+				catch (const std::exception&)
+				{
+					metadataFiles.pop_back();
+					OE_CORE_ERROR(fmt::format("Bad metadata {}", stringPath));
+				}
+			}
+		}
+
+		// Small textures are packed into shared atlas pages and show up as SubTexture2D regions,
+		// unless their metadata opts out with `Atlas: false` or asks for a sampling the atlas can't do
+		TextureAtlasBuilder atlasBuilder;
+		for (auto& file : metadataFiles)
+		{
+			if (!file.Node["Type"] || file.Node["Type"].as<String>() != Texture2D::GetStaticClassName())
+				continue;
+
+			try
+			{
+				file.Sampling.Filter = ReadTextureFilter(file.Node["Filter"]);
+				file.Sampling.UWrap = ReadTextureWrap(file.Node["UWrap"]);
+				file.Sampling.VWrap = ReadTextureWrap(file.Node["VWrap"]);
+			}
+			catch (const std::exception& e)
+			{
+				OE_CORE_ERROR(fmt::format("Bad metadata {}. Error message: '{}'", file.Path, e.what()));
+			}
+
+			if ((!file.Node["Atlas"] || file.Node["Atlas"].as<bool>()) && file.Sampling.FitsAtlas())
+				atlasBuilder.Add(file.AssetPath);
+		}
+
+		String atlasCachePath;
+		if (!cacheDirectoryPath.empty())
+		{
+			std::error_code error;
+			std::filesystem::create_directories(cacheDirectoryPath, error);
+			if (!error)
+				atlasCachePath = (std::filesystem::path(cacheDirectoryPath) / TextureAtlasCacheFileName).string();
+			else
+				OE_CORE_ERROR(fmt::format("Cache directory {} could not be created", cacheDirectoryPath));
+		}
+
+		auto atlasRegions = atlasBuilder.Build(atlasCachePath);
+
+		// Textures are created before the scenes, so the scenes get the final texture objects
+		// from the registry instead of references that have to be acquired later
+		for (int pass = 0; pass < 2; pass++)
+		{
+			for (const auto& file : metadataFiles)
+			{
+				try
+				{
+					String typeStr = file.Node["Type"].as<String>();
+					bool isTexture = typeStr == Texture2D::GetStaticClassName();
+
+					if (isTexture != (pass == 0))
+						continue;
 
 					Ref<Asset> asset = nullptr;
 
@@ -49,7 +171,7 @@ namespace OverEngine
 
 						try
 						{
-							SceneSerializer(scene).Deserialize(stringPath.substr(0, stringPath.size() - 1 - strlen(Extensions::AssetMetadataFileExtension)));
+							SceneSerializer(scene).Deserialize(file.AssetPath);
 						}
 						catch (const std::exception& e)
 						{
@@ -58,17 +180,25 @@ namespace OverEngine
 
 						asset = scene;
 					}
-					else if (typeStr == Texture2D::GetStaticClassName())
+					else if (isTexture)
 					{
 						Ref<Texture2D> texture = nullptr;
 
-						try
+						if (auto it = atlasRegions.find(file.AssetPath); it != atlasRegions.end())
 						{
-							texture = Texture2D::Create(stringPath.substr(0, stringPath.size() - 1 - strlen(Extensions::AssetMetadataFileExtension)));
+							texture = it->second;
 						}
-						catch (const std::exception& e)
+						else
 						{
-							OE_CORE_ERROR(fmt::format("Texture asset could not be loaded successfuly. Error message: '{}'", e.what()));
+							try
+							{
+								texture = Texture2D::Create(file.AssetPath);
+								file.Sampling.Apply(texture);
+							}
+							catch (const std::exception& e)
+							{
+								OE_CORE_ERROR(fmt::format("Texture asset could not be loaded successfuly. Error message: '{}'", e.what()));
+							}
 						}
 
 						asset = texture;
@@ -76,9 +206,9 @@ namespace OverEngine
 
 					if (asset)
 					{
-						asset->m_Name = metaData["Name"].as<String>();
-						asset->m_Guid = metaData["Guid"].as<uint64_t>();
-						CreateAsset(metaData["Path"].as<String>(), asset);
+						asset->m_Name = file.Node["Name"].as<String>();
+						asset->m_Guid = file.Node["Guid"].as<uint64_t>();
+						CreateAsset(file.Node["Path"].as<String>(), asset);
 					}
 					else
 					{
@@ -87,7 +217,7 @@ namespace OverEngine
 				}
 				catch (const std::exception&)
 				{
-					OE_CORE_ERROR(fmt::format("Bad metadata {}", stringPath));
+					OE_CORE_ERROR(fmt::format("Bad metadata {}", file.Path));
 				}
 			}
 		}
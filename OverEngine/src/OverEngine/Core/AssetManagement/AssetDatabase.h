@@ -9,7 +9,9 @@ namespace OverEngine
 	{
 	public:
 		static void Init();
-		static bool Init(const String& assetDirectoryPath);
+		// Files generated from the assets (like the texture atlas packing) are kept in
+		// `cacheDirectoryPath`, nothing is cached when it's empty
+		static bool Init(const String& assetDirectoryPath, const String& cacheDirectoryPath = String());
 
 		static void Clear();
 		static void Refresh();
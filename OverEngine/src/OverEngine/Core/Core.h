@@ -188,6 +188,34 @@ namespace OverEngine
 	template<typename T, typename U> using UnorderedMap = std::unordered_map<T, U>;
 	template<typename T, typename U> using Map = std::map<T, U>;
 
+	// Non owning view of contiguous elements, stand-in for C++20's std::span
+	template<typename T>
+	class Span
+	{
+	public:
+		constexpr Span() = default;
+		constexpr Span(T* data, size_t size)
+			: m_Data(data), m_Size(size) {}
+
+		template<typename Container, typename = decltype(std::declval<Container&>().data())>
+		constexpr Span(Container& container)
+			: m_Data(container.data()), m_Size(container.size()) {}
+
+		constexpr T* data() const { return m_Data; }
+		constexpr size_t size() const { return m_Size; }
+		constexpr bool empty() const { return m_Size == 0; }
+
+		constexpr T* begin() const { return m_Data; }
+		constexpr T* end() const { return m_Data + m_Size; }
+
+		constexpr T& operator[](size_t index) const { return m_Data[index]; }
+
+		constexpr Span subspan(size_t offset, size_t count) const { return { m_Data + offset, count }; }
+	private:
+		T* m_Data = nullptr;
+		size_t m_Size = 0;
+	};
+
 	template<typename T>
 	struct Vec2T
 	{
@@ -0,0 +1,73 @@
+#pragma once
+
+#include "OverEngine/Core/Math/Math.h"
+
+#include <limits>
+
+namespace OverEngine
+{
+	namespace Math
+	{
+		struct AABB2D
+		{
+			Vector2 Min = Vector2(0.0f);
+			Vector2 Max = Vector2(0.0f);
+
+			AABB2D() = default;
+			AABB2D(const Vector2& min, const Vector2& max)
+				: Min(min), Max(max) {}
+
+			inline Vector2 GetCenter() const { return (Min + Max) * 0.5f; }
+			inline Vector2 GetExtents() const { return (Max - Min) * 0.5f; }
+
+			inline bool Overlaps(const AABB2D& other) const
+			{
+				return Min.x <= other.Max.x && other.Min.x <= Max.x &&
+				       Min.y <= other.Max.y && other.Min.y <= Max.y;
+			}
+
+			static AABB2D Infinite()
+			{
+				constexpr float inf = std::numeric_limits<float>::infinity();
+				return { Vector2(-inf), Vector2(inf) };
+			}
+
+			// Bounds of the unit quad (centered at origin) transformed by `transform`
+			static AABB2D FromQuad(const Mat4x4& transform)
+			{
+				Vector2 center = transform[3];
+				Vector2 extents = {
+					(glm::abs(transform[0].x) + glm::abs(transform[1].x)) * 0.5f,
+					(glm::abs(transform[0].y) + glm::abs(transform[1].y)) * 0.5f
+				};
+
+				return { center - extents, center + extents };
+			}
+
+			// World space area visible through `viewProjection`, projected on the XY plane
+			static AABB2D FromViewProjection(const Mat4x4& viewProjection)
+			{
+				Mat4x4 inverse = glm::inverse(viewProjection);
+
+				constexpr float inf = std::numeric_limits<float>::infinity();
+				AABB2D bounds = { Vector2(inf), Vector2(-inf) };
+
+				for (int i = 0; i < 8; i++)
+				{
+					Vector4 corner = inverse * Vector4(i & 1 ? 1.0f : -1.0f, i & 2 ? 1.0f : -1.0f, i & 4 ? 1.0f : -1.0f, 1.0f);
+					Vector2 point = Vector2(corner) / corner.w;
+
+					bounds.Min = glm::min(bounds.Min, point);
+					bounds.Max = glm::max(bounds.Max, point);
+				}
+
+				// Degenerate cameras (zero sized viewports etc.) don't cull
+				if (!std::isfinite(bounds.Min.x) || !std::isfinite(bounds.Min.y) ||
+					!std::isfinite(bounds.Max.x) || !std::isfinite(bounds.Max.y))
+					return Infinite();
+
+				return bounds;
+			}
+		};
+	}
+}
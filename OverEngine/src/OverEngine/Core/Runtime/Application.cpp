@@ -8,12 +8,15 @@
 #include "OverEngine/ImGui/ImGuiLayer.h"
 
 #include "OverEngine/Renderer/Renderer.h"
+#include "OverEngine/Renderer/RenderThread.h"
+#include "OverEngine/Renderer/RendererAPI.h"
 
 namespace OverEngine
 {
 	Application* Application::s_Instance = nullptr;
 
 	Application::Application(const ApplicationProps& props)
+		: m_UseRenderThread(props.UseRenderThread)
 	{
 		s_Instance = this;
 
@@ -41,6 +44,15 @@ namespace OverEngine
 			OE_CORE_INFO("OverEngine v0.0 [UNKNOWN COMPILER] [{}]", buildType);
 		#endif
 
+		if (props.Headless)
+		{
+			OE_CORE_ASSERT(!props.UseRenderThread, "Headless applications have no context to move to a RenderThread!");
+
+			RendererAPI::SetAPI(RendererAPI::API::None);
+			Renderer::Init();
+			return;
+		}
+
 		// To initialize the Renderer a Window should exist.
 		// Because Context creating is happened when a Window in created.
 		m_Window = Window::Create(props.MainWindowProps);
@@ -84,23 +96,32 @@ namespace OverEngine
 
 	void Application::Run()
 	{
+		// Everything is set up on this thread, the context moves from here on
+		if (m_UseRenderThread)
+			RenderThread::Start(&m_Window->GetGraphicsContext());
+
 		// Game Loop
 		while (m_Running)
 		{
 			for (Layer* layer : m_LayerStack)
 				layer->OnUpdate(Time::GetDeltaTime());
 
-			if (m_ImGuiEnabled)
+			if (m_ImGuiEnabled && m_ImGuiLayer)
 			{
 				m_ImGuiLayer->Begin();
 				for (Layer* layer : m_LayerStack)
 					layer->OnImGuiRender();
 				m_ImGuiLayer->End();
 			}
-			
-			m_Window->OnUpdate();
+
+			Renderer::EndFrame();
+			if (m_Window)
+				m_Window->OnUpdate();
+			RenderThread::Kick();
 			Time::RecalculateDeltaTime();
 		}
+
+		RenderThread::Stop();
 	}
 
 	bool Application::OnWindowClose(WindowCloseEvent& e)
@@ -15,6 +15,13 @@ namespace OverEngine
 	{
 		WindowProps MainWindowProps;
 		OverEngine::RuntimeType RuntimeType = RuntimeType::Player;
+
+		// Records the rendering of frame N + 1 while a RenderThread draws frame N, see RenderThread
+		bool UseRenderThread = false;
+
+		// No window, input nor ImGui and the null RendererAPI. For dedicated servers and benchmarks,
+		// the application runs until Close is called.
+		bool Headless = false;
 	};
 
 	class ImGuiLayer;
@@ -34,7 +41,8 @@ namespace OverEngine
 
 		inline static Application& Get() { return *s_Instance; }
 		ImGuiLayer* GetImGuiLayer() { return m_ImGuiLayer; }
-		inline Window& GetWindow() { return *m_Window; }
+		inline Window& GetWindow() { OE_CORE_ASSERT(m_Window, "Headless applications have no window!"); return *m_Window; }
+		inline bool IsHeadless() const { return m_Window == nullptr; }
 	protected:
 		bool OnWindowClose(WindowCloseEvent& e);
 		bool OnWindowResize(WindowResizeEvent& e);
@@ -45,8 +53,9 @@ namespace OverEngine
 		bool m_Minimized = false;
 
 		LayerStack  m_LayerStack;
-		ImGuiLayer* m_ImGuiLayer;
+		ImGuiLayer* m_ImGuiLayer = nullptr;
 		bool m_ImGuiEnabled = false;
+		bool m_UseRenderThread = false;
 	private:
 		static Application* s_Instance;
 	};
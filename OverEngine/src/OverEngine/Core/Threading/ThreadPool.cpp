@@ -0,0 +1,107 @@
+#include "pcheader.h"
+#include "ThreadPool.h"
+
+#include <atomic>
+
+namespace OverEngine
+{
+	ThreadPool::ThreadPool(uint32_t threadCount)
+	{
+		if (threadCount == 0)
+		{
+			uint32_t hardwareThreads = std::thread::hardware_concurrency();
+			threadCount = hardwareThreads > 1 ? hardwareThreads - 1 : 0;
+		}
+
+		m_Workers.reserve(threadCount);
+		for (uint32_t i = 0; i < threadCount; i++)
+			m_Workers.emplace_back(&ThreadPool::WorkerLoop, this);
+	}
+
+	ThreadPool::~ThreadPool()
+	{
+		{
+			std::lock_guard<std::mutex> lock(m_Mutex);
+			m_Stopping = true;
+		}
+		m_TaskAvailable.notify_all();
+
+		for (auto& worker : m_Workers)
+			worker.join();
+	}
+
+	void ThreadPool::Dispatch(uint32_t count, const std::function<void(uint32_t)>& func)
+	{
+		if (count == 0)
+			return;
+
+		uint32_t helperCount = std::min(count - 1, GetThreadCount());
+		if (helperCount == 0)
+		{
+			for (uint32_t i = 0; i < count; i++)
+				func(i);
+			return;
+		}
+
+		// Indices are claimed one at a time, so whoever is free takes the next one
+		std::atomic<uint32_t> nextIndex = 0;
+		std::atomic<uint32_t> runningHelpers = helperCount;
+
+		auto run = [&]()
+		{
+			for (uint32_t i = nextIndex++; i < count; i = nextIndex++)
+				func(i);
+		};
+
+		{
+			std::lock_guard<std::mutex> lock(m_Mutex);
+			for (uint32_t i = 0; i < helperCount; i++)
+			{
+				m_Tasks.push_back([&]()
+				{
+					run();
+
+					// Take the lock so the notification can't slip in between the check and the wait below
+					if (--runningHelpers == 0)
+					{
+						std::lock_guard<std::mutex> doneLock(m_Mutex);
+						m_TaskDone.notify_all();
+					}
+				});
+			}
+		}
+		m_TaskAvailable.notify_all();
+
+		run();
+
+		std::unique_lock<std::mutex> lock(m_Mutex);
+		m_TaskDone.wait(lock, [&]() { return runningHelpers == 0; });
+	}
+
+	ThreadPool& ThreadPool::Get()
+	{
+		static ThreadPool pool;
+		return pool;
+	}
+
+	void ThreadPool::WorkerLoop()
+	{
+		while (true)
+		{
+			std::function<void()> task;
+
+			{
+				std::unique_lock<std::mutex> lock(m_Mutex);
+				m_TaskAvailable.wait(lock, [this]() { return m_Stopping || !m_Tasks.empty(); });
+
+				if (m_Tasks.empty())
+					return;
+
+				task = std::move(m_Tasks.front());
+				m_Tasks.pop_front();
+			}
+
+			task();
+		}
+	}
+}
@@ -0,0 +1,43 @@
+#pragma once
+
+#include "OverEngine/Core/Core.h"
+
+#include <condition_variable>
+#include <deque>
+#include <functional>
+#include <mutex>
+#include <thread>
+
+namespace OverEngine
+{
+	// Fixed set of worker threads for short data parallel jobs
+	class ThreadPool
+	{
+	public:
+		// `threadCount` of 0 uses one worker per hardware thread except the calling one
+		ThreadPool(uint32_t threadCount = 0);
+		~ThreadPool();
+
+		ThreadPool(const ThreadPool&) = delete;
+		ThreadPool& operator=(const ThreadPool&) = delete;
+
+		inline uint32_t GetThreadCount() const { return (uint32_t)m_Workers.size(); }
+
+		// Calls func(index) for every index in [0, count) on the workers and the calling thread,
+		// returns when all of them are done. Must not be called from inside a job.
+		void Dispatch(uint32_t count, const std::function<void(uint32_t)>& func);
+
+		// Pool shared by the engine systems, created on first use
+		static ThreadPool& Get();
+	private:
+		void WorkerLoop();
+	private:
+		Vector<std::thread> m_Workers;
+
+		std::mutex m_Mutex;
+		std::condition_variable m_TaskAvailable;
+		std::condition_variable m_TaskDone;
+		std::deque<std::function<void()>> m_Tasks;
+		bool m_Stopping = false;
+	};
+}
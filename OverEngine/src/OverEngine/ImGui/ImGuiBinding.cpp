@@ -2,6 +2,7 @@
 #include "ImGuiBinding.h"
 
 #include "OverEngine/Renderer/RendererAPI.h"
+#include "OverEngine/Renderer/RenderCommand.h"
 #include "OverEngine/Core/Window.h"
 
 #define IMGUI_IMPL_OPENGL_LOADER_DONT_CARE
@@ -26,8 +27,7 @@ namespace OverEngine
 		switch (RendererAPI::GetAPI())
 		{
 		case RendererAPI::API::None:
-			OE_CORE_ASSERT(false, "RendererAPI::None is currently not supported!");
-			break;
+			// The client API only matters for viewports, which need a renderer anyway
 		case RendererAPI::API::OpenGL:
 			ImGui_ImplGlfw_InitForOpenGL(static_cast<GLFWwindow*>(window->GetNativeWindow()), true);
 			break;
@@ -40,7 +40,15 @@ namespace OverEngine
 		switch (RendererAPI::GetAPI())
 		{
 		case RendererAPI::API::None:
-			OE_CORE_ASSERT(false, "RendererAPI::None is currently not supported!");
+			s_RendererShutdownFunction = []() {};
+			s_RendererNewFrameFunction = []()
+			{
+				// Nothing is uploaded, but ImGui still needs the font atlas to be built
+				unsigned char* pixels;
+				int width, height;
+				ImGui::GetIO().Fonts->GetTexDataAsAlpha8(&pixels, &width, &height);
+			};
+			s_RenderFunction = [](ImDrawData*) {};
 			break;
 		case RendererAPI::API::OpenGL:
 			ImGui_ImplOpenGL3_Init("#version 410");
@@ -49,5 +57,15 @@ namespace OverEngine
 			s_RenderFunction = ImGui_ImplOpenGL3_RenderDrawData;
 			break;
 		}
+
+		// Creates the device objects (and the font texture) now rather than on the first frame,
+		// which may run on the RenderThread while the main thread already uses the fonts
+		s_RendererNewFrameFunction();
+	}
+
+	void ImGuiBinding::NewFrame()
+	{
+		RenderCommand::Submit(s_RendererNewFrameFunction);
+		s_PlatformNewFrameFunction();
 	}
 }
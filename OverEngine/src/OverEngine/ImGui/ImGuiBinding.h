@@ -17,11 +17,8 @@ namespace OverEngine
 			s_PlatformShutdownFunction();
 		}
 
-		inline static void NewFrame()
-		{
-			s_RendererNewFrameFunction();
-			s_PlatformNewFrameFunction();
-		}
+		// The renderer part is recorded while the RenderThread runs
+		static void NewFrame();
 
 		inline static void Render(ImDrawData* drawData)
 		{
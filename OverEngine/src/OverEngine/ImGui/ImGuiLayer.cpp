@@ -8,9 +8,42 @@
 
 #include "OverEngine/Core/Runtime/Application.h"
 #include "OverEngine/Input/Input.h"
+#include "OverEngine/Renderer/RenderThread.h"
 
 namespace OverEngine
 {
+	// Copy of a frame's draw data, drawn by the RenderThread while ImGui builds the next frame
+	struct DrawDataSnapshot
+	{
+		ImDrawData Data;
+		Vector<ImDrawList*> Lists;
+
+		DrawDataSnapshot(const ImDrawData& drawData)
+			: Data(drawData)
+		{
+			Lists.reserve(drawData.CmdListsCount);
+			for (int i = 0; i < drawData.CmdListsCount; i++)
+				Lists.push_back(drawData.CmdLists[i]->CloneOutput());
+
+			Data.CmdLists = Lists.data();
+		}
+
+		DrawDataSnapshot(DrawDataSnapshot&& other) noexcept
+			: Data(other.Data), Lists(std::move(other.Lists))
+		{
+			Data.CmdLists = Lists.data();
+			other.Lists.clear();
+		}
+
+		DrawDataSnapshot(const DrawDataSnapshot&) = delete;
+
+		~DrawDataSnapshot()
+		{
+			for (ImDrawList* list : Lists)
+				IM_DELETE(list);
+		}
+	};
+
 	ImGuiLayer::ImGuiLayer()
 		: Layer("ImGuiLayer")
 	{
@@ -40,10 +73,11 @@ namespace OverEngine
 			style.Colors[ImGuiCol_WindowBg].w = 1.0f;
 		}
 
+		// Fonts first, the binding creates their texture
+		io.Fonts->AddFontFromMemoryCompressedTTF(&Roboto_compressed_data, Roboto_compressed_size, 15.0f);
+
 		// Setup Platform/Renderer bindings
 		ImGuiBinding::Init(&Application::Get().GetWindow());
-
-		io.Fonts->AddFontFromMemoryCompressedTTF(&Roboto_compressed_data, Roboto_compressed_size, 15.0f);
 	}
 
 	void ImGuiLayer::OnDetach()
@@ -76,6 +110,18 @@ namespace OverEngine
 
 		// Rendering
 		ImGui::Render();
+
+		if (RenderThread::IsRecording())
+		{
+			OE_CORE_ASSERT(!(io.ConfigFlags & ImGuiConfigFlags_ViewportsEnable), "ImGui viewports are not supported with a RenderThread!");
+
+			RenderThread::GetQueue().Submit([snapshot = DrawDataSnapshot(*ImGui::GetDrawData())]() mutable
+			{
+				ImGuiBinding::Render(&snapshot.Data);
+			});
+			return;
+		}
+
 		ImGuiBinding::Render(ImGui::GetDrawData());
 
 		if (io.ConfigFlags & ImGuiConfigFlags_ViewportsEnable)
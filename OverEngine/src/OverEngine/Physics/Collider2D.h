@@ -22,6 +22,8 @@ namespace OverEngine
 		virtual CollisionShape2DType GetType() const = 0;
 		virtual b2Shape* GetBox2DShape(const Mat4x4& transform) = 0;
 
+		const Vector2& GetOffset() const { return m_Offset; }
+
 	protected:
 		Vector2 m_Offset = { 0.0f, 0.0f };
 	};
@@ -4,7 +4,9 @@
 #include "OverEngine/Core/Core.h"
 
 #include "OverEngine/Renderer/RendererAPI.h"
+#include "OverEngine/Renderer/RenderThread.h"
 #include "Platform/OpenGL/OpenGLBuffer.h"
+#include "Platform/Null/NullBuffer.h"
 
 namespace OverEngine
 {
@@ -12,8 +14,8 @@ namespace OverEngine
 	{
 		switch (RendererAPI::GetAPI())
 		{
-		case RendererAPI::API::None:    OE_CORE_ASSERT(false, "RendererAPI::None is currently not supported!"); return nullptr;
-		case RendererAPI::API::OpenGL:  return CreateRef<OpenGLVertexBuffer>(vertices, size, staticDraw);
+		case RendererAPI::API::None:    return CreateRef<NullVertexBuffer>(vertices, size, staticDraw);
+		case RendererAPI::API::OpenGL:  return CreateRenderResource<OpenGLVertexBuffer>(vertices, size, staticDraw);
 		}
 
 		OE_CORE_ASSERT(false, "Unknown RendererAPI!");
@@ -24,8 +26,20 @@ namespace OverEngine
 	{
 		switch (RendererAPI::GetAPI())
 		{
-		case RendererAPI::API::None:    OE_CORE_ASSERT(false, "RendererAPI::None is currently not supported!"); return nullptr;
-		case RendererAPI::API::OpenGL:  return CreateRef<OpenGLVertexBuffer>();
+		case RendererAPI::API::None:    return CreateRef<NullVertexBuffer>();
+		case RendererAPI::API::OpenGL:  return CreateRenderResource<OpenGLVertexBuffer>();
+		}
+
+		OE_CORE_ASSERT(false, "Unknown RendererAPI!");
+		return nullptr;
+	}
+
+	Ref<StreamingVertexBuffer> StreamingVertexBuffer::Create(uint32_t segmentSize, uint32_t segmentCount)
+	{
+		switch (RendererAPI::GetAPI())
+		{
+		case RendererAPI::API::None:    return CreateRef<NullStreamingVertexBuffer>(segmentSize, segmentCount);
+		case RendererAPI::API::OpenGL:  return CreateRenderResource<OpenGLStreamingVertexBuffer>(segmentSize, segmentCount);
 		}
 
 		OE_CORE_ASSERT(false, "Unknown RendererAPI!");
@@ -36,8 +50,8 @@ namespace OverEngine
 	{
 		switch (RendererAPI::GetAPI())
 		{
-		case RendererAPI::API::None:    OE_CORE_ASSERT(false, "RendererAPI::None is currently not supported!"); return nullptr;
-		case RendererAPI::API::OpenGL:  return CreateRef<OpenGLIndexBuffer>(indices, count, staticDraw);
+		case RendererAPI::API::None:    return CreateRef<NullIndexBuffer>(indices, count, staticDraw);
+		case RendererAPI::API::OpenGL:  return CreateRenderResource<OpenGLIndexBuffer>(indices, count, staticDraw);
 		}
 
 		OE_CORE_ASSERT(false, "Unknown RendererAPI!");
@@ -48,8 +62,20 @@ namespace OverEngine
 	{
 		switch (RendererAPI::GetAPI())
 		{
-		case RendererAPI::API::None:    OE_CORE_ASSERT(false, "RendererAPI::None is currently not supported!"); return nullptr;
-		case RendererAPI::API::OpenGL:  return CreateRef<OpenGLIndexBuffer>();
+		case RendererAPI::API::None:    return CreateRef<NullIndexBuffer>();
+		case RendererAPI::API::OpenGL:  return CreateRenderResource<OpenGLIndexBuffer>();
+		}
+
+		OE_CORE_ASSERT(false, "Unknown RendererAPI!");
+		return nullptr;
+	}
+
+	Ref<StorageBuffer> StorageBuffer::Create(uint32_t size, const void* data)
+	{
+		switch (RendererAPI::GetAPI())
+		{
+		case RendererAPI::API::None:    return CreateRef<NullStorageBuffer>(size, data);
+		case RendererAPI::API::OpenGL:  return CreateRenderResource<OpenGLStorageBuffer>(size, data);
 		}
 
 		OE_CORE_ASSERT(false, "Unknown RendererAPI!");
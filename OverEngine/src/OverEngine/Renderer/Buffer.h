@@ -4,7 +4,11 @@ namespace OverEngine
 {
 	enum class ShaderDataType
 	{
-		None = 0, Float, Float2, Float3, Float4, Mat3, Mat4, Int, Int2, Int3, Int4, Bool
+		None = 0, Float, Float2, Float3, Float4, Mat3, Mat4, Int, Int2, Int3, Int4, UInt, Bool,
+
+		// Packed types, mostly used for compact per-quad/per-instance data
+		// UByte4 and UShort4 are usually used with BufferElement::Normalized
+		UByte4, UShort4, Half2, Half4
 	};
 
 	static uint32_t ShaderDataTypeSize(ShaderDataType type)
@@ -21,7 +25,12 @@ namespace OverEngine
 		case ShaderDataType::Int2:     return 4 * 2;
 		case ShaderDataType::Int3:     return 4 * 3;
 		case ShaderDataType::Int4:     return 4 * 4;
+		case ShaderDataType::UInt:     return 4;
 		case ShaderDataType::Bool:     return 1;
+		case ShaderDataType::UByte4:   return 1 * 4;
+		case ShaderDataType::UShort4:  return 2 * 4;
+		case ShaderDataType::Half2:    return 2 * 2;
+		case ShaderDataType::Half4:    return 2 * 4;
 		default:;
 		}
 
@@ -58,7 +67,12 @@ namespace OverEngine
 			case ShaderDataType::Int2:    return 2;
 			case ShaderDataType::Int3:    return 3;
 			case ShaderDataType::Int4:    return 4;
+			case ShaderDataType::UInt:    return 1;
 			case ShaderDataType::Bool:    return 1;
+			case ShaderDataType::UByte4:  return 4;
+			case ShaderDataType::UShort4: return 4;
+			case ShaderDataType::Half2:   return 2;
+			case ShaderDataType::Half4:   return 4;
 			default:;
 			}
 
@@ -79,6 +93,10 @@ namespace OverEngine
 		}
 
 		inline uint32_t GetStride() const { return m_Stride; }
+
+		// Per instance layouts advance once per instance instead of once per vertex
+		inline bool IsPerInstance() const { return m_PerInstance; }
+		inline void SetPerInstance(bool perInstance) { m_PerInstance = perInstance; }
 		inline const Vector<BufferElement>& GetElements() const { return m_Elements; }
 
 		Vector<BufferElement>::iterator begin() { return m_Elements.begin(); }
@@ -100,6 +118,7 @@ namespace OverEngine
 	private:
 		Vector<BufferElement> m_Elements;
 		uint32_t m_Stride = 0;
+		bool m_PerInstance = false;
 	};
 
 	class VertexBuffer
@@ -121,6 +140,31 @@ namespace OverEngine
 		virtual void SetLayout(const BufferLayout& layout) = 0;
 	};
 
+	// A VertexBuffer which is persistently mapped and used as a ring of `segmentCount` segments.
+	// Data is written directly into GPU visible memory, a segment is fenced when it's left and
+	// waited on before it's written into again. Meant to be used for data that's rewritten every frame.
+	class StreamingVertexBuffer : public VertexBuffer
+	{
+	public:
+		static Ref<StreamingVertexBuffer> Create(uint32_t segmentSize, uint32_t segmentCount = 3);
+
+		virtual ~StreamingVertexBuffer() = default;
+
+		// Returns a write pointer with at least `minSize` bytes after it (moves to the next segment if needed).
+		// `available` receives the amount of bytes which can be written before the next Commit.
+		// The returned location is aligned to the layout's stride.
+		virtual void* Reserve(uint32_t minSize, uint32_t& available) = 0;
+
+		// Marks `size` bytes after the last Reserve as used and returns their offset from the start of the buffer.
+		virtual uint32_t Commit(uint32_t size) = 0;
+
+		// Fences the current segment and moves to the next one, call once per frame.
+		virtual void NextFrame() = 0;
+
+		virtual uint32_t GetSegmentSize() const = 0;
+		virtual uint32_t GetSegmentCount() const = 0;
+	};
+
 	class IndexBuffer
 	{
 	public:
@@ -138,4 +182,23 @@ namespace OverEngine
 
 		virtual uint32_t GetCount() const = 0;
 	};
+
+	// Shader storage buffer, read and written by shaders.
+	// Also holds the arguments of RenderCommand::DrawIndirect.
+	class StorageBuffer
+	{
+	public:
+		// `data` may be null, the content is undefined then
+		static Ref<StorageBuffer> Create(uint32_t size, const void* data = nullptr);
+
+		virtual ~StorageBuffer() = default;
+
+		// Binds to the `binding` point of the shaders' storage blocks
+		virtual void Bind(uint32_t binding) const = 0;
+
+		virtual void SetData(const void* data, uint32_t size, uint32_t offset = 0) = 0;
+
+		virtual uint32_t GetSize() const = 0;
+		virtual uint32_t GetRendererID() const = 0;
+	};
 }
@@ -0,0 +1,348 @@
+#include "pcheader.h"
+#include "Font.h"
+
+#include "OverEngine/Core/FileSystem/FileSystem.h"
+#include "OverEngine/Renderer/TextureAtlas.h"
+
+#include <imgui/imgui.h>
+#include "fonts/Roboto.h"
+
+// ImGui already ships stb_truetype, a private copy is compiled here
+#define STBTT_STATIC
+#define STB_TRUETYPE_IMPLEMENTATION
+#include <imgui/imstb_truetype.h>
+
+namespace OverEngine
+{
+	////////////////////////////////////////////////////////
+	/// Font ///////////////////////////////////////////////
+	////////////////////////////////////////////////////////
+
+	Ref<Font> Font::Create(const String& path, const FontProps& props)
+	{
+		String data = FileSystem::ReadFile(path);
+		if (data.empty())
+			return nullptr;
+
+		return Create(data.data(), data.size(), props);
+	}
+
+	Ref<Font> Font::Create(const void* data, size_t size, const FontProps& props)
+	{
+		auto font = CreateRef<Font>(data, size, props);
+		return font->IsValid() ? font : nullptr;
+	}
+
+	Ref<Font> Font::GetDefault()
+	{
+		// Not kept alive by itself, so it's gone with the last text using it (and before the context)
+		static std::weak_ptr<Font> s_Default;
+		if (auto font = s_Default.lock())
+			return font;
+
+		// ImGui's decompressor isn't public, but its atlas keeps a decompressed copy of the fonts added to it
+		ImFontAtlas atlas;
+		atlas.AddFontFromMemoryCompressedTTF(Roboto_compressed_data, Roboto_compressed_size, FontProps().GlyphSize);
+		const ImFontConfig& config = atlas.ConfigData.back();
+
+		auto font = Create(config.FontData, (size_t)config.FontDataSize);
+		s_Default = font;
+		return font;
+	}
+
+	Font::Font(const void* data, size_t size, const FontProps& props)
+	{
+		OE_PROFILE_FUNCTION();
+
+		const auto* ttf = static_cast<const unsigned char*>(data);
+
+		stbtt_fontinfo info;
+		int offset = stbtt_GetFontOffsetForIndex(ttf, 0);
+		if (offset < 0 || !stbtt_InitFont(&info, ttf, offset))
+		{
+			OE_CORE_ERROR("Invalid TrueType font!");
+			return;
+		}
+
+		float scale = stbtt_ScaleForMappingEmToPixels(&info, props.GlyphSize);
+		float unitsToEms = scale / props.GlyphSize;
+		float pixelsToEms = 1.0f / props.GlyphSize;
+
+		int ascent, descent, lineGap;
+		stbtt_GetFontVMetrics(&info, &ascent, &descent, &lineGap);
+		m_Ascent = ascent * unitsToEms;
+		m_Descent = descent * unitsToEms;
+		m_LineHeight = (ascent - descent + lineGap) * unitsToEms;
+
+		struct Bitmap
+		{
+			Glyph* Target;
+			unsigned char* Pixels;
+			int Width, Height;
+			uint32_t X = 0, Y = 0;
+		};
+
+		Vector<Bitmap> bitmaps;
+		Vector<std::pair<uint32_t, int>> glyphIndices;
+
+		// Distance 0 (the outline) is 128, `Padding` pixels away is 0 or 255
+		constexpr unsigned char onEdgeValue = 128;
+		float distanceScale = (float)onEdgeValue / (float)std::max(props.Padding, 1u);
+
+		for (const auto& [first, last] : props.Ranges)
+		{
+			for (uint32_t codepoint = first; codepoint <= last; codepoint++)
+			{
+				int glyphIndex = stbtt_FindGlyphIndex(&info, (int)codepoint);
+				if (glyphIndex == 0)
+					continue;
+
+				glyphIndices.push_back({ codepoint, glyphIndex });
+
+				int advance, leftSideBearing;
+				stbtt_GetGlyphHMetrics(&info, glyphIndex, &advance, &leftSideBearing);
+
+				Glyph& glyph = m_Glyphs[codepoint];
+				glyph.Advance = advance * unitsToEms;
+
+				int width, height, xOffset, yOffset;
+				unsigned char* pixels = stbtt_GetGlyphSDF(&info, scale, glyphIndex, (int)props.Padding, onEdgeValue, distanceScale, &width, &height, &xOffset, &yOffset);
+				if (!pixels)
+					continue;
+
+				// Bitmaps go down from their top left corner
+				glyph.Min = Vector2(xOffset, -(yOffset + height)) * pixelsToEms;
+				glyph.Max = Vector2(xOffset + width, -yOffset) * pixelsToEms;
+
+				bitmaps.push_back({ &glyph, pixels, width, height });
+			}
+		}
+
+		// Tallest first packs tighter, the atlas grows until everything fits
+		std::sort(bitmaps.begin(), bitmaps.end(), [](const Bitmap& a, const Bitmap& b) { return a.Height > b.Height; });
+
+		uint32_t atlasWidth = 128, atlasHeight = 128;
+		while (true)
+		{
+			SkylinePacker packer(atlasWidth, atlasHeight);
+
+			// A texel apart, so bilinear filtering doesn't blend neighbours
+			bool packed = std::all_of(bitmaps.begin(), bitmaps.end(), [&packer](Bitmap& bitmap) {
+				return packer.Pack(bitmap.Width + 1, bitmap.Height + 1, bitmap.X, bitmap.Y);
+			});
+
+			if (packed)
+				break;
+
+			(atlasWidth <= atlasHeight ? atlasWidth : atlasHeight) *= 2;
+		}
+
+		// White with the distance in alpha, so the quad shader only needs to know it's a distance field
+		Vector<uint8_t> pixels((size_t)atlasWidth * atlasHeight * 4, 0xFF);
+		for (size_t i = 3; i < pixels.size(); i += 4)
+			pixels[i] = 0;
+
+		for (const Bitmap& bitmap : bitmaps)
+		{
+			for (int y = 0; y < bitmap.Height; y++)
+			{
+				uint8_t* row = &pixels[(((size_t)bitmap.Y + y) * atlasWidth + bitmap.X) * 4];
+				for (int x = 0; x < bitmap.Width; x++)
+					row[x * 4 + 3] = bitmap.Pixels[y * bitmap.Width + x];
+			}
+
+			bitmap.Target->TexRect = {
+				(float)bitmap.X / atlasWidth, (float)bitmap.Y / atlasHeight,
+				(float)bitmap.Width / atlasWidth, (float)bitmap.Height / atlasHeight
+			};
+
+			stbtt_FreeSDF(bitmap.Pixels, nullptr);
+		}
+
+		m_Atlas = Texture2D::Create(atlasWidth, atlasHeight, TextureFormat::RGBA8, pixels.data());
+
+		if (info.kern || info.gpos)
+		{
+			for (const auto& [left, leftIndex] : glyphIndices)
+			{
+				for (const auto& [right, rightIndex] : glyphIndices)
+				{
+					if (int kerning = stbtt_GetGlyphKernAdvance(&info, leftIndex, rightIndex))
+						m_Kerning[((uint64_t)left << 32) | right] = kerning * unitsToEms;
+				}
+			}
+		}
+	}
+
+	const Font::Glyph* Font::GetGlyph(uint32_t codepoint) const
+	{
+		auto it = m_Glyphs.find(codepoint);
+		if (it != m_Glyphs.end())
+			return &it->second;
+
+		it = m_Glyphs.find('?');
+		return it != m_Glyphs.end() ? &it->second : nullptr;
+	}
+
+	float Font::GetKerning(uint32_t left, uint32_t right) const
+	{
+		auto it = m_Kerning.find(((uint64_t)left << 32) | right);
+		return it != m_Kerning.end() ? it->second : 0.0f;
+	}
+
+	////////////////////////////////////////////////////////
+	/// TextLayout /////////////////////////////////////////
+	////////////////////////////////////////////////////////
+
+	// Decodes the UTF-8 sequence at `text[i]` and moves `i` past it, invalid sequences give U+FFFD
+	static uint32_t NextCodepoint(const String& text, size_t& i)
+	{
+		constexpr uint32_t replacement = 0xFFFD;
+
+		uint8_t lead = (uint8_t)text[i++];
+		if (lead < 0x80)
+			return lead;
+
+		uint32_t length, codepoint;
+		if ((lead & 0xE0) == 0xC0)      { length = 1; codepoint = lead & 0x1F; }
+		else if ((lead & 0xF0) == 0xE0) { length = 2; codepoint = lead & 0x0F; }
+		else if ((lead & 0xF8) == 0xF0) { length = 3; codepoint = lead & 0x07; }
+		else return replacement;
+
+		for (uint32_t j = 0; j < length; j++)
+		{
+			if (i == text.size() || ((uint8_t)text[i] & 0xC0) != 0x80)
+				return replacement;
+
+			codepoint = (codepoint << 6) | ((uint8_t)text[i++] & 0x3F);
+		}
+
+		return codepoint;
+	}
+
+	TextLayout::TextLayout(const Ref<Font>& font, const String& text, TextAlignment alignment)
+		: m_Font(font)
+	{
+		m_Glyphs.reserve(text.size());
+
+		Vector2 pen = Vector2(0.0f);
+		size_t lineStart = 0;
+		uint32_t previous = 0;
+
+		auto finishLine = [&]()
+		{
+			if (alignment != TextAlignment::Left)
+			{
+				float shift = alignment == TextAlignment::Center ? -pen.x * 0.5f : -pen.x;
+				for (size_t i = lineStart; i < m_Glyphs.size(); i++)
+					m_Glyphs[i].Center.x += shift;
+			}
+
+			lineStart = m_Glyphs.size();
+		};
+
+		for (size_t i = 0; i < text.size();)
+		{
+			uint32_t codepoint = NextCodepoint(text, i);
+			if (codepoint == '\n')
+			{
+				finishLine();
+				pen = { 0.0f, pen.y - font->GetLineHeight() };
+				previous = 0;
+				continue;
+			}
+
+			const Font::Glyph* glyph = font->GetGlyph(codepoint);
+			if (!glyph)
+				continue;
+
+			if (previous)
+				pen.x += font->GetKerning(previous, codepoint);
+			previous = codepoint;
+
+			if (glyph->Max.x > glyph->Min.x)
+				m_Glyphs.push_back({ pen + (glyph->Min + glyph->Max) * 0.5f, glyph->Max - glyph->Min, glyph->TexRect });
+
+			pen.x += glyph->Advance;
+		}
+
+		finishLine();
+
+		if (m_Glyphs.empty())
+			return;
+
+		m_Min = Vector2(std::numeric_limits<float>::max());
+		m_Max = Vector2(std::numeric_limits<float>::lowest());
+		for (const Glyph& glyph : m_Glyphs)
+		{
+			m_Min = glm::min(m_Min, glyph.Center - glyph.Size * 0.5f);
+			m_Max = glm::max(m_Max, glyph.Center + glyph.Size * 0.5f);
+		}
+	}
+
+	Ref<TextLayout> TextLayout::Create(const Ref<Font>& font, const String& text, TextAlignment alignment)
+	{
+		OE_CORE_ASSERT(font, "Font is null!");
+		return CreateRef<TextLayout>(font, text, alignment);
+	}
+
+	struct TextLayoutKey
+	{
+		const Font* TextFont;
+		TextAlignment Alignment;
+		String Text;
+
+		bool operator==(const TextLayoutKey& other) const
+		{
+			return TextFont == other.TextFont && Alignment == other.Alignment && Text == other.Text;
+		}
+	};
+
+	struct TextLayoutKeyHash
+	{
+		size_t operator()(const TextLayoutKey& key) const
+		{
+			size_t hash = std::hash<String>()(key.Text);
+			hash ^= std::hash<const void*>()(key.TextFont) + 0x9E3779B9 + (hash << 6) + (hash >> 2);
+			return hash ^ (size_t)key.Alignment;
+		}
+	};
+
+	struct CachedTextLayout
+	{
+		Ref<TextLayout> Layout;
+		bool Used;
+	};
+
+	static std::unordered_map<TextLayoutKey, CachedTextLayout, TextLayoutKeyHash> s_TextLayoutCache;
+
+	Ref<TextLayout> TextLayout::Get(const Ref<Font>& font, const String& text, TextAlignment alignment)
+	{
+		auto [it, inserted] = s_TextLayoutCache.try_emplace({ font.get(), alignment, text });
+		if (inserted)
+			it->second.Layout = Create(font, text, alignment);
+
+		it->second.Used = true;
+		return it->second.Layout;
+	}
+
+	void TextLayout::UpdateCache()
+	{
+		for (auto it = s_TextLayoutCache.begin(); it != s_TextLayoutCache.end();)
+		{
+			if (!it->second.Used)
+			{
+				it = s_TextLayoutCache.erase(it);
+				continue;
+			}
+
+			it->second.Used = false;
+			it++;
+		}
+	}
+
+	void TextLayout::ClearCache()
+	{
+		s_TextLayoutCache.clear();
+	}
+}
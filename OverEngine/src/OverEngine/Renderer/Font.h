@@ -0,0 +1,115 @@
+#pragma once
+
+#include "OverEngine/Core/Core.h"
+#include "OverEngine/Renderer/Texture.h"
+
+namespace OverEngine
+{
+	struct FontProps
+	{
+		// Pixels per em of the glyphs in the atlas. Distance fields stay sharp
+		// when scaled up, so this only needs to be big enough for small details.
+		float GlyphSize = 48.0f;
+
+		// Pixels around each outline covered by the distance field
+		uint32_t Padding = 6;
+
+		// Inclusive ranges of the codepoints to put in the atlas
+		Vector<std::pair<uint32_t, uint32_t>> Ranges = { { 0x20, 0x7E } };
+	};
+
+	/**
+	 * Signed distance field atlas of a TrueType font's glyphs, drawn by Renderer2D::DrawText.
+	 * Every metric is in ems, with y going up from the baseline.
+	 */
+	class Font
+	{
+	public:
+		struct Glyph
+		{
+			// Quad relative to the pen position, empty for blank glyphs
+			Vector2 Min = Vector2(0.0f);
+			Vector2 Max = Vector2(0.0f);
+
+			// Normalized rect inside the atlas
+			Rect TexRect = Rect(0.0f);
+
+			float Advance = 0.0f;
+		};
+
+		// Returns nullptr if the file can't be read or isn't a TrueType font
+		static Ref<Font> Create(const String& path, const FontProps& props = FontProps());
+		static Ref<Font> Create(const void* data, size_t size, const FontProps& props = FontProps());
+
+		// Roboto Light, the font of the editor
+		static Ref<Font> GetDefault();
+
+		Font(const void* data, size_t size, const FontProps& props);
+
+		// Falls back to '?', nullptr if the font doesn't have it either
+		const Glyph* GetGlyph(uint32_t codepoint) const;
+		float GetKerning(uint32_t left, uint32_t right) const;
+
+		inline float GetAscent() const { return m_Ascent; }
+		inline float GetDescent() const { return m_Descent; }
+		inline float GetLineHeight() const { return m_LineHeight; }
+
+		inline const Ref<Texture2D>& GetAtlas() const { return m_Atlas; }
+		inline bool IsValid() const { return m_Atlas != nullptr; }
+	private:
+		UnorderedMap<uint32_t, Glyph> m_Glyphs;
+		UnorderedMap<uint64_t, float> m_Kerning; // Non zero pairs only, keyed by left << 32 | right
+
+		float m_Ascent = 0.0f;
+		float m_Descent = 0.0f;
+		float m_LineHeight = 0.0f;
+
+		Ref<Texture2D> m_Atlas;
+	};
+
+	enum class TextAlignment : uint8_t
+	{
+		Left = 0,
+		Center,
+		Right
+	};
+
+	/**
+	 * Glyph quads of a string, laid out once and drawn as many times as needed.
+	 * The first line's baseline starts at the origin, each line goes one line height down.
+	 */
+	class TextLayout
+	{
+	public:
+		struct Glyph
+		{
+			Vector2 Center;
+			Vector2 Size;
+			Rect TexRect;
+		};
+
+		static Ref<TextLayout> Create(const Ref<Font>& font, const String& text, TextAlignment alignment = TextAlignment::Left);
+
+		// Same as Create, but the layouts are cached by font, text and alignment.
+		// Layouts which aren't used for a frame are dropped. Main thread only.
+		static Ref<TextLayout> Get(const Ref<Font>& font, const String& text, TextAlignment alignment = TextAlignment::Left);
+
+		// Called once per frame by Renderer2D::EndFrame
+		static void UpdateCache();
+		static void ClearCache();
+
+		TextLayout(const Ref<Font>& font, const String& text, TextAlignment alignment);
+
+		inline const Ref<Font>& GetFont() const { return m_Font; }
+		inline const Vector<Glyph>& GetGlyphs() const { return m_Glyphs; }
+
+		// Bounds of the glyph quads
+		inline const Vector2& GetMin() const { return m_Min; }
+		inline const Vector2& GetMax() const { return m_Max; }
+	private:
+		Ref<Font> m_Font;
+		Vector<Glyph> m_Glyphs;
+		Vector2 m_Min = Vector2(0.0f);
+		Vector2 m_Max = Vector2(0.0f);
+	};
+}
@@ -4,7 +4,10 @@
 #include "OverEngine/Core/Core.h"
 
 #include "OverEngine/Renderer/RendererAPI.h"
+#include "OverEngine/Renderer/RenderCommand.h"
+#include "OverEngine/Renderer/RenderThread.h"
 #include "Platform/OpenGL/OpenGLFrameBuffer.h"
+#include "Platform/Null/NullFrameBuffer.h"
 
 namespace OverEngine
 {
@@ -13,12 +16,23 @@ namespace OverEngine
 	{
 		switch (RendererAPI::GetAPI())
 		{
-		case RendererAPI::API::None:    OE_CORE_ASSERT(false, "RendererAPI::None is currently not supported!"); return nullptr;
-		case RendererAPI::API::OpenGL:  return CreateRef<OpenGLFrameBuffer>(props);
+		case RendererAPI::API::None:    return CreateRef<NullFrameBuffer>(props);
+		case RendererAPI::API::OpenGL:  return CreateRenderResource<OpenGLFrameBuffer>(props);
 		}
 
 		OE_CORE_ASSERT(false, "Unknown RendererAPI!");
 		return nullptr;
 	}
 
+	void FrameBuffer::ReleaseUnusedAttachments(uint32_t maxIdleFrames)
+	{
+		switch (RendererAPI::GetAPI())
+		{
+		case RendererAPI::API::None:    return;
+		case RendererAPI::API::OpenGL:  RenderCommand::Submit([maxIdleFrames]() { OpenGLFrameBuffer::ReleaseUnusedAttachments(maxIdleFrames); }); return;
+		}
+
+		OE_CORE_ASSERT(false, "Unknown RendererAPI!");
+	}
+
 }
@@ -1,12 +1,16 @@
 #pragma once
 
 #include "OverEngine/Core/Core.h"
+#include "OverEngine/Renderer/TextureEnums.h"
 
 namespace OverEngine
 {
 	struct FrameBufferProps
 	{
 		uint32_t Width, Height;
+		TextureFormat ColorFormat = TextureFormat::RGBA8;
+
+		// Multisampled attachments can't be sampled as regular textures
 		uint32_t Samples = 1;
 
 		bool SwapChainTarget = false;
@@ -17,11 +21,17 @@ namespace OverEngine
 	public:
 		static Ref<FrameBuffer> Create(const FrameBufferProps& props);
 
+		// Attachments of resized or destroyed framebuffers are kept for the next ones with the same
+		// size, format and sample count. Deletes those unused for more than `maxIdleFrames` calls,
+		// FrameBufferPool::EndFrame calls it once per frame.
+		static void ReleaseUnusedAttachments(uint32_t maxIdleFrames);
+
 		virtual ~FrameBuffer() = default;
 
 		virtual void Bind() = 0;
 		virtual void Unbind() = 0;
 
+		// Swaps the attachments right away, see FrameBufferPool::RequestResize to do it once per frame
 		virtual void Resize(uint32_t width, uint32_t height) = 0;
 
 		virtual uint32_t GetColorAttachmentRendererID() const = 0;
@@ -0,0 +1,112 @@
+#include "pcheader.h"
+#include "FrameBufferPool.h"
+
+#include "OverEngine/Renderer/RenderCommand.h"
+
+namespace OverEngine
+{
+	struct FreeFrameBuffer
+	{
+		Ref<FrameBuffer> Target;
+		uint32_t IdleFrames;
+	};
+
+	struct PendingResize
+	{
+		std::weak_ptr<FrameBuffer> Target;
+		uint32_t Width, Height;
+	};
+
+	static UnorderedMap<uint64_t, Vector<FreeFrameBuffer>> s_FreeFrameBuffers;
+	static Vector<Ref<FrameBuffer>> s_TransientFrameBuffers;
+	static UnorderedMap<const FrameBuffer*, PendingResize> s_PendingResizes;
+
+	// Width (24 bits) | Height (24 bits) | Samples (8 bits) | ColorFormat (8 bits)
+	static uint64_t GetKey(const FrameBufferProps& props)
+	{
+		OE_CORE_ASSERT(!props.SwapChainTarget, "The swap chain's FrameBuffer can't be pooled!");
+		OE_CORE_ASSERT(props.Width < (1 << 24) && props.Height < (1 << 24) && props.Samples < (1 << 8), "FrameBuffer is too big to be pooled!");
+
+		return ((uint64_t)props.Width << 40) | ((uint64_t)props.Height << 16) | ((uint64_t)props.Samples << 8) | (uint64_t)props.ColorFormat;
+	}
+
+	Ref<FrameBuffer> FrameBufferPool::Acquire(const FrameBufferProps& props)
+	{
+		auto it = s_FreeFrameBuffers.find(GetKey(props));
+		if (it == s_FreeFrameBuffers.end() || it->second.empty())
+			return FrameBuffer::Create(props);
+
+		// Most recently released first, the older ones get a chance to expire
+		Ref<FrameBuffer> frameBuffer = std::move(it->second.back().Target);
+		it->second.pop_back();
+		return frameBuffer;
+	}
+
+	void FrameBufferPool::Release(const Ref<FrameBuffer>& frameBuffer)
+	{
+		if (!frameBuffer)
+			return;
+
+		s_FreeFrameBuffers[GetKey(frameBuffer->GetProps())].push_back({ frameBuffer, 0 });
+	}
+
+	Ref<FrameBuffer> FrameBufferPool::AcquireTransient(const FrameBufferProps& props)
+	{
+		return s_TransientFrameBuffers.emplace_back(Acquire(props));
+	}
+
+	void FrameBufferPool::RequestResize(const Ref<FrameBuffer>& frameBuffer, uint32_t width, uint32_t height)
+	{
+		OE_CORE_ASSERT(width > 0 && height > 0, "Zero sized FrameBuffer is invalid!");
+		s_PendingResizes[frameBuffer.get()] = { frameBuffer, width, height };
+	}
+
+	void FrameBufferPool::EndFrame()
+	{
+		// Queued after everything drawn this frame, which still uses the old attachments
+		for (const auto& [key, resize] : s_PendingResizes)
+		{
+			if (Ref<FrameBuffer> frameBuffer = resize.Target.lock())
+				RenderCommand::Submit([frameBuffer, width = resize.Width, height = resize.Height]() { frameBuffer->Resize(width, height); });
+		}
+		s_PendingResizes.clear();
+
+		for (auto it = s_FreeFrameBuffers.begin(); it != s_FreeFrameBuffers.end();)
+		{
+			auto& frameBuffers = it->second;
+			frameBuffers.erase(std::remove_if(frameBuffers.begin(), frameBuffers.end(), [](FreeFrameBuffer& frameBuffer) {
+				return ++frameBuffer.IdleFrames > MaxIdleFrames;
+			}), frameBuffers.end());
+
+			if (frameBuffers.empty())
+				it = s_FreeFrameBuffers.erase(it);
+			else
+				it++;
+		}
+
+		// Released after the eviction, so they can be reused for a whole frame
+		for (const auto& frameBuffer : s_TransientFrameBuffers)
+			Release(frameBuffer);
+		s_TransientFrameBuffers.clear();
+
+		// After the resizes and evictions above, which release attachments
+		FrameBuffer::ReleaseUnusedAttachments(MaxIdleFrames);
+	}
+
+	void FrameBufferPool::Clear()
+	{
+		s_FreeFrameBuffers.clear();
+		s_TransientFrameBuffers.clear();
+		s_PendingResizes.clear();
+
+		FrameBuffer::ReleaseUnusedAttachments(0);
+	}
+
+	uint32_t FrameBufferPool::GetFreeCount()
+	{
+		uint32_t count = 0;
+		for (const auto& [key, frameBuffers] : s_FreeFrameBuffers)
+			count += (uint32_t)frameBuffers.size();
+		return count;
+	}
+}
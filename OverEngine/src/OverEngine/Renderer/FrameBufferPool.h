@@ -0,0 +1,46 @@
+#pragma once
+
+#include "OverEngine/Core/Core.h"
+#include "OverEngine/Renderer/FrameBuffer.h"
+
+namespace OverEngine
+{
+	/**
+	 * Recycles render targets, keyed by size, color format and sample count.
+	 * Framebuffers released to the pool are kept for a few frames and handed out
+	 * again to the next Acquire with the same props instead of being recreated.
+	 * Resized framebuffers take their new attachments from the ones released by
+	 * other framebuffers when the size matches (see FrameBuffer::ReleaseUnusedAttachments).
+	 *
+	 * Resizes requested through the pool are applied together at the end of the frame,
+	 * so a window dragged across many frames of events only reallocates once per frame.
+	 * Main thread only.
+	 */
+	class FrameBufferPool
+	{
+	public:
+		// Frames a released framebuffer or attachment stays in the pool before it's destroyed
+		static constexpr uint32_t MaxIdleFrames = 3;
+
+		// Reuses a released framebuffer with the same props or creates a new one
+		static Ref<FrameBuffer> Acquire(const FrameBufferProps& props);
+
+		// Hands `frameBuffer` back to the pool, it shouldn't be used afterwards
+		static void Release(const Ref<FrameBuffer>& frameBuffer);
+
+		// For intermediate passes, only valid until the end of the frame
+		// when it's released automatically
+		static Ref<FrameBuffer> AcquireTransient(const FrameBufferProps& props);
+
+		// Resizes `frameBuffer` at the end of the frame, the last request of the frame wins.
+		// Works for any framebuffer, pooled or not.
+		static void RequestResize(const Ref<FrameBuffer>& frameBuffer, uint32_t width, uint32_t height);
+
+		// Called once per frame by Renderer::EndFrame
+		static void EndFrame();
+		static void Clear();
+
+		// Framebuffers waiting in the pool
+		static uint32_t GetFreeCount();
+	};
+}
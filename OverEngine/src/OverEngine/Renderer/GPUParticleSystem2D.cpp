@@ -0,0 +1,221 @@
+#include "pcheader.h"
+#include "GPUParticleSystem2D.h"
+
+#include "OverEngine/Renderer/RenderCommand.h"
+#include "OverEngine/Renderer/Shader.h"
+#include "OverEngine/Core/Random.h"
+
+#include <glm/gtc/packing.hpp>
+
+namespace OverEngine
+{
+	// Size of Particle in the shaders (std430)
+	static constexpr uint32_t ParticleStride = 64;
+
+	// local_size_x of the compute shaders
+	static constexpr uint32_t WorkGroupSize = 256;
+
+	// Storage buffer binding points
+	static constexpr uint32_t ParticlesBinding = 0;
+	static constexpr uint32_t RequestsBinding = 1;
+	static constexpr uint32_t AliveListBinding = 2;
+	static constexpr uint32_t DrawCommandBinding = 3;
+
+	// { vertexCount, instanceCount, firstVertex, baseInstance }, the update pass counts the instances
+	static constexpr uint32_t EmptyDrawCommand[4] = { 4, 0, 0, 0 };
+
+	struct GPUParticleShaders
+	{
+		Ref<Shader> Emit;
+		Ref<Shader> Update;
+		Ref<Shader> Render;
+	};
+
+	// Shared by every system, gone with the last one
+	static Ref<GPUParticleShaders> GetShaders()
+	{
+		static std::weak_ptr<GPUParticleShaders> s_Shaders;
+		if (auto shaders = s_Shaders.lock())
+			return shaders;
+
+		auto shaders = CreateRef<GPUParticleShaders>();
+		shaders->Emit = Shader::Create("assets/shaders/GPUParticles2DEmit.glsl");
+		shaders->Update = Shader::Create("assets/shaders/GPUParticles2DUpdate.glsl");
+		shaders->Render = Shader::Create("assets/shaders/GPUParticles2D.glsl");
+
+		s_Shaders = shaders;
+		return shaders;
+	}
+
+	static inline uint32_t GroupCount(uint32_t threadCount)
+	{
+		return (threadCount + WorkGroupSize - 1) / WorkGroupSize;
+	}
+
+	GPUParticleSystem2D::GPUParticleSystem2D(uint32_t poolSize)
+		: m_PoolSize(poolSize)
+	{
+		OE_CORE_ASSERT(poolSize > 0, "GPUParticleSystem2D needs a pool!");
+
+		// Zeroed particles are dead
+		Vector<uint8_t> deadParticles((size_t)poolSize * ParticleStride, 0);
+		m_Particles = StorageBuffer::Create((uint32_t)deadParticles.size(), deadParticles.data());
+
+		m_AliveList = StorageBuffer::Create(poolSize * sizeof(uint32_t));
+		m_DrawCommand = StorageBuffer::Create(sizeof(EmptyDrawCommand), EmptyDrawCommand);
+		m_VertexArray = VertexArray::Create();
+
+		m_Shaders = GetShaders();
+	}
+
+	void GPUParticleSystem2D::Emit(const Particle2DProps& props, uint32_t count)
+	{
+		if (count == 0 || props.LifeTime <= 0.0f)
+			return;
+
+		EmitRequest& request = m_PendingRequests.emplace_back();
+
+		request.Position = props.Position;
+		request.Rotation = props.Rotation;
+
+		request.Velocity = props.Velocity;
+		request.VelocityVariation = props.VelocityVariation;
+
+		request.AngularVelocity = props.AngularVelocity;
+		request.AngularVelocityVariation = props.AngularVelocityVariation;
+		request.LifeTime = props.LifeTime;
+		request.First = m_PendingCount;
+
+		request.BirthSize = props.BirthSize;
+		request.DeathSize = props.DeathSize;
+
+		request.BirthColor = glm::packUnorm4x8(props.RenderingProps.BirthColor);
+		request.DeathColor = glm::packUnorm4x8(props.RenderingProps.DeathColor);
+		request.Count = count;
+
+		m_PendingCount += count;
+	}
+
+	void GPUParticleSystem2D::Update(TimeStep deltaTime)
+	{
+		OE_PROFILE_FUNCTION();
+
+		// Emitting more than the pool holds in one go only keeps the last ones
+		uint32_t emitCount = std::min(m_PendingCount, m_PoolSize);
+		uint32_t emitSkip = m_PendingCount - emitCount;
+		uint32_t emitStart = m_NextParticleIndex;
+		uint32_t requestCount = (uint32_t)m_PendingRequests.size();
+
+		m_NextParticleIndex = (uint32_t)(((uint64_t)m_NextParticleIndex + m_PendingCount) % m_PoolSize);
+		m_PendingCount = 0;
+
+		uint32_t requestsSize = requestCount * (uint32_t)sizeof(EmitRequest);
+		if (requestsSize > 0 && (!m_Requests || m_Requests->GetSize() < requestsSize))
+			m_Requests = StorageBuffer::Create(std::max(requestsSize, m_Requests ? 2 * m_Requests->GetSize() : requestsSize));
+
+		RenderCommand::Submit([
+			shaders = m_Shaders, particles = m_Particles, requestBuffer = m_Requests, alive = m_AliveList, drawCommand = m_DrawCommand,
+			requests = std::move(m_PendingRequests), requestCount, emitCount, emitSkip, emitStart,
+			poolSize = m_PoolSize, seed = Random::UInt32(), deltaTime = (float)deltaTime
+		]()
+		{
+			particles->Bind(ParticlesBinding);
+			alive->Bind(AliveListBinding);
+			drawCommand->Bind(DrawCommandBinding);
+
+			if (emitCount > 0)
+			{
+				requestBuffer->SetData(requests.data(), requestCount * (uint32_t)sizeof(EmitRequest));
+				requestBuffer->Bind(RequestsBinding);
+
+				shaders->Emit->Bind();
+				shaders->Emit->UploadUniformInt("u_RequestCount", (int)requestCount);
+				shaders->Emit->UploadUniformInt("u_EmitCount", (int)emitCount);
+				shaders->Emit->UploadUniformInt("u_EmitSkip", (int)emitSkip);
+				shaders->Emit->UploadUniformInt("u_EmitStart", (int)emitStart);
+				shaders->Emit->UploadUniformInt("u_PoolSize", (int)poolSize);
+				shaders->Emit->UploadUniformInt("u_Seed", (int)seed);
+				RenderCommand::DispatchCompute(GroupCount(emitCount));
+				RenderCommand::Barrier(BarrierFlags_Storage);
+			}
+
+			// The update pass counts the alive particles again
+			drawCommand->SetData(EmptyDrawCommand, sizeof(EmptyDrawCommand));
+
+			shaders->Update->Bind();
+			shaders->Update->UploadUniformInt("u_PoolSize", (int)poolSize);
+			shaders->Update->UploadUniformFloat("u_DeltaTime", deltaTime);
+			RenderCommand::DispatchCompute(GroupCount(poolSize));
+			RenderCommand::Barrier(BarrierFlags_Storage | BarrierFlags_Command);
+		});
+
+		m_PendingRequests.clear();
+	}
+
+	void GPUParticleSystem2D::Render(const Mat4x4& viewProjection)
+	{
+		OE_PROFILE_FUNCTION();
+
+		// Same texture coordinates as a Renderer2D quad with these props
+		Ref<Texture2D> sprite = m_RenderingProps.Sprite;
+		Rect rect = { 0.0f, 0.0f, 1.0f, 1.0f };
+		if (sprite && sprite->GetType() == TextureType::SubTexture)
+			rect = std::static_pointer_cast<SubTexture2D>(sprite)->GetRect();
+
+		Vector4 coord = {
+			Vector2(rect.x, rect.y) * m_RenderingProps.Tiling + m_RenderingProps.Offset,
+			Vector2(rect.z, rect.w) * m_RenderingProps.Tiling
+		};
+
+		if (m_RenderingProps.Flip & TextureFlip_X)
+		{
+			coord.x += coord.z;
+			coord.z = -coord.z;
+		}
+
+		if (m_RenderingProps.Flip & TextureFlip_Y)
+		{
+			coord.y += coord.w;
+			coord.w = -coord.w;
+		}
+
+		RenderCommand::Submit([
+			shaders = m_Shaders, particles = m_Particles, alive = m_AliveList, drawCommand = m_DrawCommand,
+			vertexArray = m_VertexArray, sprite, coord, viewProjection
+		]()
+		{
+			particles->Bind(ParticlesBinding);
+			alive->Bind(AliveListBinding);
+
+			if (sprite)
+				sprite->Bind(0);
+
+			shaders->Render->Bind();
+			shaders->Render->UploadUniformMat4("u_ViewProjMatrix", viewProjection);
+			shaders->Render->UploadUniformFloat4("u_TexCoordRect", coord);
+			shaders->Render->UploadUniformInt("u_HasSprite", sprite ? 1 : 0);
+			shaders->Render->UploadUniformInt("u_Sprite", 0);
+
+			vertexArray->Bind();
+
+			RenderCommand::DisableDepthWriting();
+			RenderCommand::DrawIndirect(vertexArray, drawCommand, 0, DrawType::TriangleStrip);
+			RenderCommand::EnableDepthWriting();
+		});
+	}
+
+	void GPUParticleSystem2D::UpdateAndRender(TimeStep deltaTime, const Mat4x4& viewMatrix, const Camera& camera, bool useDepthTesting)
+	{
+		bool depthTestWasEnabled = RenderCommand::IsDepthTestingEnabled();
+		bool badDepthTestingState = useDepthTesting != depthTestWasEnabled;
+
+		if (badDepthTestingState)
+			RenderCommand::SetDepthTesting(useDepthTesting);
+
+		Update(deltaTime);
+		Render(camera.GetProjection() * viewMatrix);
+
+		if (badDepthTestingState)
+			RenderCommand::SetDepthTesting(depthTestWasEnabled);
+	}
+}
@@ -0,0 +1,91 @@
+#pragma once
+
+#include "OverEngine/Core/Core.h"
+#include "OverEngine/Core/Time/TimeStep.h"
+#include "OverEngine/Renderer/Camera.h"
+#include "OverEngine/Renderer/Buffer.h"
+#include "OverEngine/Renderer/VertexArray.h"
+#include "OverEngine/Renderer/ParticleSystem2D.h"
+
+namespace OverEngine
+{
+	struct GPUParticleShaders;
+
+	/**
+	 * ParticleSystem2D simulated on the GPU. The particles live in a storage buffer,
+	 * compute shaders emit, age and move them and the alive ones are drawn straight
+	 * from it with an indirect draw. Nothing is read back, so the CPU cost doesn't
+	 * depend on the particle count.
+	 *
+	 * Every particle is drawn with the sprite of SetRenderingProps, the colors
+	 * are per particle and come from the Particle2DProps they were emitted with.
+	 */
+	class GPUParticleSystem2D
+	{
+	public:
+		GPUParticleSystem2D(uint32_t poolSize = 1000000);
+
+		// Emits `count` particles with randomized variations, queued until the next Update.
+		// The oldest particles are replaced once the pool is full.
+		void Emit(const Particle2DProps& props, uint32_t count = 1);
+
+		// Only the sprite, tiling, offset and flip are used
+		void SetRenderingProps(const Particle2DRenderingProps& props) { m_RenderingProps = props; }
+		const Particle2DRenderingProps& GetRenderingProps() const { return m_RenderingProps; }
+
+		// Emits the queued particles then ages and moves all of them
+		void Update(TimeStep deltaTime);
+
+		// Draws the alive particles. Depth tested if enabled but never written,
+		// overlapping particles are blended in no particular order.
+		void Render(const Mat4x4& viewProjection);
+
+		// Drop in replacement for ParticleSystem2D::UpdateAndRender
+		void UpdateAndRender(TimeStep deltaTime, const Mat4x4& viewMatrix, const Camera& camera, bool useDepthTesting = true);
+
+		inline uint32_t GetPoolSize() const { return m_PoolSize; }
+	private:
+		// Matches EmitRequest in the compute shaders (std430)
+		struct EmitRequest
+		{
+			Vector3 Position;
+			float Rotation;
+
+			Vector2 Velocity;
+			Vector2 VelocityVariation;
+
+			float AngularVelocity;
+			float AngularVelocityVariation;
+			float LifeTime;
+			uint32_t First; // Offset of the first particle among this Update's emissions
+
+			Vector2 BirthSize;
+			Vector2 DeathSize;
+
+			uint32_t BirthColor;
+			uint32_t DeathColor;
+			uint32_t Count;
+			uint32_t Padding = 0;
+		};
+
+		static_assert(sizeof(EmitRequest) == 80, "EmitRequest must match its std430 layout");
+
+		uint32_t m_PoolSize;
+		uint32_t m_NextParticleIndex = 0;
+
+		Vector<EmitRequest> m_PendingRequests;
+		uint32_t m_PendingCount = 0;
+
+		Particle2DRenderingProps m_RenderingProps;
+
+		Ref<StorageBuffer> m_Particles;
+		Ref<StorageBuffer> m_Requests;
+		Ref<StorageBuffer> m_AliveList;
+		Ref<StorageBuffer> m_DrawCommand;
+
+		// Attribute-less, the vertex shader reads the particles
+		Ref<VertexArray> m_VertexArray;
+
+		Ref<GPUParticleShaders> m_Shaders;
+	};
+}
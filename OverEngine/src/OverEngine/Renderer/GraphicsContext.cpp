@@ -5,6 +5,7 @@
 
 #include "OverEngine/Core/Window.h"
 #include "Platform/OpenGL/OpenGLContext.h"
+#include "Platform/Null/NullContext.h"
 
 namespace OverEngine
 {
@@ -12,7 +13,7 @@ namespace OverEngine
 	{
 		switch (RendererAPI::GetAPI())
 		{
-		case RendererAPI::API::None:    OE_CORE_ASSERT(false, "RendererAPI::None is currently not supported!"); return nullptr;
+		case RendererAPI::API::None:    return CreateScope<NullContext>();
 		case RendererAPI::API::OpenGL:  return CreateScope<OpenGLContext>(window);
 		}
 
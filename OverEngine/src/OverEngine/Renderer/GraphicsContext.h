@@ -16,6 +16,9 @@ namespace OverEngine
 
 		virtual void Current() = 0;
 
+		// Detaches the context from the calling thread, so another one can make it current
+		virtual void Release() = 0;
+
 		virtual const char* GetInfoVersion() = 0;
 		virtual const char* GetInfoVendor() = 0;
 		virtual const char* GetInfoRenderer() = 0;
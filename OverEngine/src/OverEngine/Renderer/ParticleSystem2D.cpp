@@ -4,94 +4,331 @@
 #include "OverEngine/Renderer/Renderer2D.h"
 #include "OverEngine/Core/Random.h"
 
+#if defined(__SSE__) || defined(_M_X64) || (defined(_M_IX86_FP) && _M_IX86_FP >= 1)
+	#define OE_PARTICLES_SSE
+	#include <xmmintrin.h>
+#endif
+
 namespace OverEngine
 {
+	////////////////////////////////////////////////////////
+	/// Kernels ////////////////////////////////////////////
+	////////////////////////////////////////////////////////
+
+	// values[i] += rates[i] * scale
+	static void MultiplyAdd(float* values, const float* rates, float scale, size_t count)
+	{
+		size_t i = 0;
+
+	#ifdef OE_PARTICLES_SSE
+		__m128 scale4 = _mm_set1_ps(scale);
+		for (; i + 4 <= count; i += 4)
+			_mm_storeu_ps(values + i, _mm_add_ps(_mm_loadu_ps(values + i), _mm_mul_ps(_mm_loadu_ps(rates + i), scale4)));
+	#endif
+
+		for (; i < count; i++)
+			values[i] += rates[i] * scale;
+	}
+
+	// values[i] -= amount
+	static void Subtract(float* values, float amount, size_t count)
+	{
+		size_t i = 0;
+
+	#ifdef OE_PARTICLES_SSE
+		__m128 amount4 = _mm_set1_ps(amount);
+		for (; i + 4 <= count; i += 4)
+			_mm_storeu_ps(values + i, _mm_sub_ps(_mm_loadu_ps(values + i), amount4));
+	#endif
+
+		for (; i < count; i++)
+			values[i] -= amount;
+	}
+
+	////////////////////////////////////////////////////////
+	/// ParticleSystem2D ///////////////////////////////////
+	////////////////////////////////////////////////////////
+
 	ParticleSystem2D::ParticleSystem2D(uint32_t poolSize)
-		: m_NextParticleIndex(poolSize - 1)
+		: m_PoolSize(poolSize), m_Random(Random::UInt32())
 	{
-		m_ParticlePool.resize(poolSize);
 	}
 
-	void ParticleSystem2D::Emit(const Particle2DProps& props)
+	float ParticleSystem2D::RandomSigned()
 	{
-		Particle& particle = m_ParticlePool[m_NextParticleIndex];
+		return (float)(m_Random() - std::minstd_rand::min()) / (float)(std::minstd_rand::max() - std::minstd_rand::min()) * 2.0f - 1.0f;
+	}
 
-		particle.Active = true;
+	template<typename T>
+	static inline uint64_t GetCurveHash(const LifetimeCurve<T>* curve)
+	{
+		return curve ? curve->GetHash() : 0;
+	}
 
-		particle.Position = props.Position;
-		particle.Rotation = props.Rotation;
+	bool ParticleSystem2D::IsGroupOf(const ParticleGroup& group, const Particle2DRenderingProps& props)
+	{
+		const Particle2DRenderingProps& groupProps = group.RenderingProps;
+		return groupProps.Sprite == props.Sprite && groupProps.Tiling == props.Tiling && groupProps.Offset == props.Offset && groupProps.Flip == props.Flip &&
+		       groupProps.BirthColor == props.BirthColor && groupProps.DeathColor == props.DeathColor &&
+		       group.ColorCurveHash == GetCurveHash(props.ColorOverLifetime) && group.SizeCurveHash == GetCurveHash(props.SizeOverLifetime);
+	}
+
+	ParticleSystem2D::ParticleGroup& ParticleSystem2D::GetGroup(const Particle2DRenderingProps& props)
+	{
+		if (m_LastGroup < m_Groups.size() && IsGroupOf(m_Groups[m_LastGroup], props))
+			return m_Groups[m_LastGroup];
+
+		for (size_t i = 0; i < m_Groups.size(); i++)
+		{
+			if (IsGroupOf(m_Groups[i], props))
+			{
+				m_LastGroup = i;
+				return m_Groups[i];
+			}
+		}
 
-		particle.Velocity        = props.Velocity        + props.VelocityVariation        * Vector2(Random::Range(-1.0f, 1.0f), Random::Range(-1.0f, 1.0f));
-		particle.AngularVelocity = props.AngularVelocity + props.AngularVelocityVariation * Random::Range(-1.0f, 1.0f);
+		m_LastGroup = m_Groups.size();
+		ParticleGroup& group = m_Groups.emplace_back();
+		group.RenderingProps = props;
+		group.RenderingProps.ColorOverLifetime = nullptr;
+		group.RenderingProps.SizeOverLifetime = nullptr;
+		group.ColorCurveHash = GetCurveHash(props.ColorOverLifetime);
+		group.SizeCurveHash = GetCurveHash(props.SizeOverLifetime);
 
-		particle.RenderingProps = props.RenderingProps;
+		// Sampled once, Render only looks them up
+		if (props.ColorOverLifetime && !props.ColorOverLifetime->IsEmpty())
+		{
+			group.ColorTable.resize(CurveResolution);
+			for (uint32_t i = 0; i < CurveResolution; i++)
+				group.ColorTable[i] = props.ColorOverLifetime->Evaluate((float)i / (CurveResolution - 1));
+		}
 
-		particle.BirthSize = props.BirthSize;
-		particle.DeathSize = props.DeathSize;
+		if (props.SizeOverLifetime && !props.SizeOverLifetime->IsEmpty())
+		{
+			group.SizeTable.resize(CurveResolution);
+			for (uint32_t i = 0; i < CurveResolution; i++)
+				group.SizeTable[i] = props.SizeOverLifetime->Evaluate((float)i / (CurveResolution - 1));
 
-		particle.LifeTime = particle.LifeLeft = props.LifeTime;
+			group.MaxSizeScale = 0.0f;
+			for (float scale : group.SizeTable)
+				group.MaxSizeScale = std::max(group.MaxSizeScale, std::abs(scale));
+		}
 
-		m_NextParticleIndex = ++m_NextParticleIndex % (uint32_t)m_ParticlePool.size();
+		return group;
 	}
 
-	void ParticleSystem2D::UpdateAndRender(TimeStep deltaTime, const Mat4x4& viewMatrix, const Camera& camera, bool useDepthTesting)
+	void ParticleSystem2D::Emit(const Particle2DProps& props, uint32_t count)
 	{
-		bool depthTestWasEnabled = RenderCommand::IsDepthTestingEnabled();
-		bool badDepthTestingState = useDepthTesting != depthTestWasEnabled;
+		count = std::min(count, m_PoolSize > m_ParticleCount ? m_PoolSize - m_ParticleCount : 0u);
+		if (count == 0 || props.LifeTime <= 0.0f)
+			return;
 
-		if (badDepthTestingState)
-			RenderCommand::SetDepthTesting(useDepthTesting);
+		ParticleGroup& group = GetGroup(props.RenderingProps);
+		Vector2 sizeDelta = props.BirthSize - props.DeathSize;
 
-		Renderer2D::BeginScene(viewMatrix, camera);
+		for (uint32_t i = 0; i < count; i++)
+		{
+			Vector2 velocity      = props.Velocity        + props.VelocityVariation        * Vector2(RandomSigned(), RandomSigned());
+			float angularVelocity = props.AngularVelocity + props.AngularVelocityVariation * RandomSigned();
 
-		float depth = 0.0f;
-		float leftLifeRatio = 0.0f;
+			// In ParticleStream order
+			const float values[ParticleStream_Count] = {
+				props.Position.x, props.Position.y, props.Position.z,
+				velocity.x, velocity.y,
+				props.Rotation, angularVelocity,
+				props.LifeTime, 1.0f / props.LifeTime,
+				props.DeathSize.x, props.DeathSize.y,
+				sizeDelta.x, sizeDelta.y,
+				(float)m_NextSequence++
+			};
 
-		for (auto& particle : m_ParticlePool)
+			for (uint8_t stream = 0; stream < ParticleStream_Count; stream++)
+				group.Streams[stream].push_back(values[stream]);
+		}
+
+		m_ParticleCount += count;
+	}
+
+	void ParticleSystem2D::Clear()
+	{
+		m_Groups.clear();
+		m_LastGroup = 0;
+		m_ParticleCount = 0;
+		m_Bounds = AABB2D();
+		m_NextSequence = 0;
+		m_OldestSequence = 0;
+	}
+
+	void ParticleSystem2D::Update(TimeStep deltaTime)
+	{
+		OE_PROFILE_FUNCTION();
+
+		float dt = deltaTime;
+
+		constexpr float inf = std::numeric_limits<float>::infinity();
+		m_Bounds = { Vector2(inf), Vector2(-inf) };
+		float oldestSequence = (float)m_NextSequence;
+
+		for (ParticleGroup& group : m_Groups)
 		{
-			if (!particle.Active)
-				continue;
+			auto& streams = group.Streams;
+			uint32_t count = group.GetCount();
 
 			// Process Life
-			particle.LifeLeft -= deltaTime;
-			if (particle.LifeLeft <= 0.0f)
+			float* lifeLeft = streams[ParticleStream_LifeLeft].data();
+			Subtract(lifeLeft, dt, count);
+
+			// Swap dead particles with the last alive one
+			uint32_t aliveCount = count;
+			for (uint32_t i = 0; i < aliveCount;)
 			{
-				particle.Active = false;
-				continue;
+				if (lifeLeft[i] > 0.0f)
+				{
+					i++;
+					continue;
+				}
+
+				aliveCount--;
+				for (auto& stream : streams)
+					stream[i] = stream[aliveCount];
 			}
 
-			// Move Particle
-			particle.Position.x += particle.Velocity.x * deltaTime;
-			particle.Position.y += particle.Velocity.y * deltaTime;
-			particle.Rotation += particle.AngularVelocity * deltaTime;
+			for (auto& stream : streams)
+				stream.resize(aliveCount);
 
-			if (useDepthTesting)
-				depth += 0.0001f;
+			m_ParticleCount -= count - aliveCount;
 
-			leftLifeRatio = particle.LifeLeft / particle.LifeTime; // 1 = New, 0 = Old
-			Color color = glm::mix(particle.RenderingProps.DeathColor, particle.RenderingProps.BirthColor, leftLifeRatio);
-			Vector2 size = glm::mix(particle.DeathSize, particle.BirthSize, leftLifeRatio);
+			// Move Particles
+			MultiplyAdd(streams[ParticleStream_PositionX].data(), streams[ParticleStream_VelocityX].data(), dt, aliveCount);
+			MultiplyAdd(streams[ParticleStream_PositionY].data(), streams[ParticleStream_VelocityY].data(), dt, aliveCount);
+			MultiplyAdd(streams[ParticleStream_Rotation].data(), streams[ParticleStream_AngularVelocity].data(), dt, aliveCount);
 
-			Vector3 position = particle.Position;
-			position.z += depth;
+			// Bounds of the centers, grown by the half diagonal of the biggest quad
+			const float* positionX = streams[ParticleStream_PositionX].data();
+			const float* positionY = streams[ParticleStream_PositionY].data();
+			const float* deathSizeX = streams[ParticleStream_DeathSizeX].data();
+			const float* deathSizeY = streams[ParticleStream_DeathSizeY].data();
+			const float* sizeDeltaX = streams[ParticleStream_SizeDeltaX].data();
+			const float* sizeDeltaY = streams[ParticleStream_SizeDeltaY].data();
+			const float* sequence = streams[ParticleStream_Sequence].data();
 
-			if (particle.RenderingProps.Sprite)
+			Vector2 min = Vector2(inf), max = Vector2(-inf);
+			float maxSize = 0.0f;
+			for (uint32_t i = 0; i < aliveCount; i++)
 			{
-				TexturedQuadProps props;
-				props.Tint = color;
-				props.Sprite = particle.RenderingProps.Sprite;
-				props.Tiling = particle.RenderingProps.Tiling;
-				props.Offset = particle.RenderingProps.Offset;
-				props.Flip = particle.RenderingProps.Flip;
-
-				Renderer2D::DrawQuad(position, particle.Rotation, size, props);
+				oldestSequence = std::min(oldestSequence, sequence[i]);
+
+				min = { std::min(min.x, positionX[i]), std::min(min.y, positionY[i]) };
+				max = { std::max(max.x, positionX[i]), std::max(max.y, positionY[i]) };
+
+				float deathSize = std::max(std::abs(deathSizeX[i]), std::abs(deathSizeY[i]));
+				float birthSize = std::max(std::abs(deathSizeX[i] + sizeDeltaX[i]), std::abs(deathSizeY[i] + sizeDeltaY[i]));
+				maxSize = std::max(maxSize, std::max(deathSize, birthSize));
 			}
-			else
+
+			float margin = maxSize * group.MaxSizeScale * 0.7072f;
+			m_Bounds.Min = glm::min(m_Bounds.Min, min - margin);
+			m_Bounds.Max = glm::max(m_Bounds.Max, max + margin);
+		}
+
+		m_OldestSequence = (uint32_t)oldestSequence;
+		if (m_NextSequence >= (1u << 23))
+		{
+			for (ParticleGroup& group : m_Groups)
+				Subtract(group.Streams[ParticleStream_Sequence].data(), oldestSequence, group.GetCount());
+
+			m_NextSequence -= m_OldestSequence;
+			m_OldestSequence = 0;
+		}
+	}
+
+	void ParticleSystem2D::ReleaseEmptyGroups()
+	{
+		// Empty groups would keep their sprite alive
+		auto emptyGroups = std::remove_if(m_Groups.begin(), m_Groups.end(), [](const ParticleGroup& group) { return group.GetCount() == 0; });
+		if (emptyGroups != m_Groups.end())
+		{
+			m_Groups.erase(emptyGroups, m_Groups.end());
+			m_LastGroup = 0;
+		}
+	}
+
+	void ParticleSystem2D::Render(bool useDepthTesting)
+	{
+		OE_PROFILE_FUNCTION();
+
+		float depthStep = useDepthTesting ? 0.0001f : 0.0f;
+		float oldestSequence = (float)m_OldestSequence;
+
+		for (const ParticleGroup& group : m_Groups)
+		{
+			const auto& streams = group.Streams;
+			const auto& renderingProps = group.RenderingProps;
+			uint32_t count = group.GetCount();
+
+			const float* positionX = streams[ParticleStream_PositionX].data();
+			const float* positionY = streams[ParticleStream_PositionY].data();
+			const float* positionZ = streams[ParticleStream_PositionZ].data();
+			const float* rotation = streams[ParticleStream_Rotation].data();
+			const float* lifeLeft = streams[ParticleStream_LifeLeft].data();
+			const float* inverseLifeTime = streams[ParticleStream_InverseLifeTime].data();
+			const float* deathSizeX = streams[ParticleStream_DeathSizeX].data();
+			const float* deathSizeY = streams[ParticleStream_DeathSizeY].data();
+			const float* sizeDeltaX = streams[ParticleStream_SizeDeltaX].data();
+			const float* sizeDeltaY = streams[ParticleStream_SizeDeltaY].data();
+			const float* sequence = streams[ParticleStream_Sequence].data();
+
+			Color deathColor = renderingProps.DeathColor;
+			Color colorDelta = renderingProps.BirthColor - renderingProps.DeathColor;
+
+			const Color* colorTable = group.ColorTable.empty() ? nullptr : group.ColorTable.data();
+			const float* sizeTable = group.SizeTable.empty() ? nullptr : group.SizeTable.data();
+
+			m_Instances.resize(count);
+			for (uint32_t i = 0; i < count; i++)
 			{
-				Renderer2D::DrawQuad(position, particle.Rotation, size, color);
+				float depth = (sequence[i] - oldestSequence) * depthStep;
+				float leftLifeRatio = lifeLeft[i] * inverseLifeTime[i]; // 1 = New, 0 = Old
+
+				QuadInstance& instance = m_Instances[i];
+				instance.Position = { positionX[i], positionY[i], positionZ[i] + depth };
+				instance.Rotation = rotation[i];
+				instance.Size = { deathSizeX[i] + sizeDeltaX[i] * leftLifeRatio, deathSizeY[i] + sizeDeltaY[i] * leftLifeRatio };
+				instance.Tint = deathColor + colorDelta * leftLifeRatio;
+
+				if (colorTable || sizeTable)
+				{
+					uint32_t sample = (uint32_t)((1.0f - leftLifeRatio) * (CurveResolution - 1) + 0.5f);
+					if (colorTable)
+						instance.Tint *= colorTable[sample];
+					if (sizeTable)
+						instance.Size *= sizeTable[sample];
+				}
 			}
+
+			TexturedQuadProps props;
+			props.Sprite = renderingProps.Sprite;
+			props.Tiling = renderingProps.Tiling;
+			props.Offset = renderingProps.Offset;
+			props.Flip = renderingProps.Flip;
+
+			Renderer2D::DrawQuads(m_Instances, props);
 		}
+	}
 
+	void ParticleSystem2D::UpdateAndRender(TimeStep deltaTime, const Mat4x4& viewMatrix, const Camera& camera, bool useDepthTesting)
+	{
+		bool depthTestWasEnabled = RenderCommand::IsDepthTestingEnabled();
+		bool badDepthTestingState = useDepthTesting != depthTestWasEnabled;
+
+		if (badDepthTestingState)
+			RenderCommand::SetDepthTesting(useDepthTesting);
+
+		Update(deltaTime);
+		ReleaseEmptyGroups();
+
+		Renderer2D::BeginScene(viewMatrix, camera);
+		Render(useDepthTesting);
 		Renderer2D::EndScene();
 
 		if (badDepthTestingState)
@@ -3,17 +3,98 @@
 #include "OverEngine/Core/Core.h"
 #include "OverEngine/Core/Time/TimeStep.h"
 #include "OverEngine/Renderer/Camera.h"
+#include "OverEngine/Core/Math/AABB2D.h"
 
 #include "OverEngine/Renderer/Texture.h"
 #include "OverEngine/Renderer/Renderer2D.h"
 
+#include <random>
+
 namespace OverEngine
 {
+	/**
+	 * Piecewise linear value over a particle's life, 0 is its birth and 1 its death.
+	 * An empty curve is 1 all along.
+	 */
+	template<typename T>
+	class LifetimeCurve
+	{
+	public:
+		struct Key
+		{
+			float Time;
+			T Value;
+		};
+
+		// Sorted by time
+		inline const Vector<Key>& GetKeys() const { return m_Keys; }
+
+		// Sorts `keys` by time
+		void SetKeys(Vector<Key> keys)
+		{
+			std::stable_sort(keys.begin(), keys.end(), [](const Key& a, const Key& b) { return a.Time < b.Time; });
+			m_Keys = std::move(keys);
+
+			// FNV-1a of the keys, kept so comparing curves doesn't walk them
+			m_Hash = 0;
+			if (!m_Keys.empty())
+			{
+				m_Hash = 14695981039346656037ull;
+				auto hashBytes = [this](const void* data, size_t size)
+				{
+					for (size_t i = 0; i < size; i++)
+						m_Hash = (m_Hash ^ static_cast<const uint8_t*>(data)[i]) * 1099511628211ull;
+				};
+
+				for (const Key& key : m_Keys)
+				{
+					hashBytes(&key.Time, sizeof(key.Time));
+					hashBytes(&key.Value, sizeof(key.Value));
+				}
+			}
+		}
+
+		// Same keys give the same hash, 0 for an empty curve
+		inline uint64_t GetHash() const { return m_Hash; }
+
+		inline bool IsEmpty() const { return m_Keys.empty(); }
+
+		T Evaluate(float time) const
+		{
+			if (m_Keys.empty())
+				return T(1.0f);
+
+			if (time <= m_Keys.front().Time)
+				return m_Keys.front().Value;
+
+			for (size_t i = 1; i < m_Keys.size(); i++)
+			{
+				const Key& next = m_Keys[i];
+				if (time > next.Time)
+					continue;
+
+				const Key& previous = m_Keys[i - 1];
+				float span = next.Time - previous.Time;
+				return span > 0.0f ? glm::mix(previous.Value, next.Value, (time - previous.Time) / span) : next.Value;
+			}
+
+			return m_Keys.back().Value;
+		}
+	private:
+		Vector<Key> m_Keys;
+		uint64_t m_Hash = 0;
+	};
+
 	struct Particle2DRenderingProps
 	{
 		Color BirthColor = Color(1.0f);
 		Color DeathColor = Color(0.0f);
 
+		// Multiply the color and the size blended from birth to death, none if null.
+		// ParticleSystem2D::Emit samples them once per new curve, they only need to outlive the call.
+		const LifetimeCurve<Color>* ColorOverLifetime = nullptr;
+		const LifetimeCurve<float>* SizeOverLifetime = nullptr;
+
 		Ref<Texture2D> Sprite;
 
 		Vector2 Tiling = Vector2(1.0f);
@@ -42,37 +123,110 @@ namespace OverEngine
 		Particle2DRenderingProps RenderingProps;
 	};
 
+	/**
+	 * Particles simulated on the CPU and drawn with Renderer2D.
+	 *
+	 * Particles emitted with the same rendering props share one copy of them and
+	 * are stored together as a structure of arrays. Dead particles are swapped
+	 * out with the last alive one, so updates only touch alive particles and run
+	 * over packed float arrays.
+	 */
 	class ParticleSystem2D
 	{
 	public:
 		ParticleSystem2D(uint32_t poolSize = 100000);
 
-		// Emit a single particle
-		void Emit(const Particle2DProps& props);
+		// Emits `count` particles with randomized variations, the ones not fitting in the pool are ignored
+		void Emit(const Particle2DProps& props, uint32_t count = 1);
+
+		// Ages and moves the particles, dead ones are removed.
+		// Systems only touch their own state, so different systems can be updated on different threads.
+		// Groups left empty are kept, see ReleaseEmptyGroups.
+		void Update(TimeStep deltaTime);
+
+		// Drops the groups without particles along with their sprites.
+		// Releasing a sprite may free a render resource, so call it from the main thread.
+		void ReleaseEmptyGroups();
+
+		// Draws the particles inside the current Renderer2D scene. With depth testing,
+		// each particle is pushed slightly further than the ones emitted before it.
+		void Render(bool useDepthTesting = true);
 
 		void UpdateAndRender(TimeStep deltaTime, const Mat4x4& viewMatrix, const Camera& camera, bool useDepthTesting = true);
 
-	private:
+		// Removes every particle
+		void Clear();
+
+		inline uint32_t GetParticleCount() const { return m_ParticleCount; }
 
-		struct Particle
+		// Particles above a smaller size are kept until they die
+		inline uint32_t GetPoolSize() const { return m_PoolSize; }
+		inline void SetPoolSize(uint32_t poolSize) { m_PoolSize = poolSize; }
+
+		// World bounds of the particles' quads, as of the last Update
+		inline const AABB2D& GetBounds() const { return m_Bounds; }
+	private:
+		// Per particle values, one array each
+		enum ParticleStream : uint8_t
 		{
-			Vector3 Position;
-			Vector2 Velocity;
+			ParticleStream_PositionX = 0,
+			ParticleStream_PositionY,
+			ParticleStream_PositionZ,
+			ParticleStream_VelocityX,
+			ParticleStream_VelocityY,
+			ParticleStream_Rotation,
+			ParticleStream_AngularVelocity,
+			ParticleStream_LifeLeft,
+			ParticleStream_InverseLifeTime,
+			ParticleStream_DeathSizeX,
+			ParticleStream_DeathSizeY,
+			ParticleStream_SizeDeltaX, // BirthSize - DeathSize
+			ParticleStream_SizeDeltaY,
+			ParticleStream_Sequence, // Emission order, the depth follows it instead of the index
+			ParticleStream_Count
+		};
 
-			float Rotation;
-			float AngularVelocity;
+		// Samples of the lifetime curves, from birth to death
+		static constexpr uint32_t CurveResolution = 64;
 
-			Vector2 BirthSize = Vector2(0.0f);
-			Vector2 DeathSize = Vector2(1.0f);
+		// Alive particles sharing their rendering props
+		struct ParticleGroup
+		{
+			Particle2DRenderingProps RenderingProps; // Without the curves, they're sampled in the tables
+			std::array<Vector<float>, ParticleStream_Count> Streams;
 
-			float LifeTime, LifeLeft;
+			// Empty if the curve is
+			Vector<Color> ColorTable;
+			Vector<float> SizeTable;
+			float MaxSizeScale = 1.0f;
 
-			Particle2DRenderingProps RenderingProps;
+			// Of the curves the tables are sampled from
+			uint64_t ColorCurveHash = 0;
+			uint64_t SizeCurveHash = 0;
 
-			bool Active;
+			inline uint32_t GetCount() const { return (uint32_t)Streams[0].size(); }
 		};
 
-		Vector<Particle> m_ParticlePool;
-		uint32_t m_NextParticleIndex;
+		static bool IsGroupOf(const ParticleGroup& group, const Particle2DRenderingProps& props);
+		ParticleGroup& GetGroup(const Particle2DRenderingProps& props);
+		float RandomSigned(); // In [-1, 1]
+
+		Vector<ParticleGroup> m_Groups;
+		size_t m_LastGroup = 0; // Consecutive emits usually share their props
+
+		uint32_t m_PoolSize;
+		uint32_t m_ParticleCount = 0;
+
+		AABB2D m_Bounds;
+
+		// Sequences are rebased on the oldest particle before they get too big to be exact in a float
+		uint32_t m_NextSequence = 0;
+		uint32_t m_OldestSequence = 0; // As of the last Update
+
+		// Own engine, the shared Random isn't thread safe
+		std::minstd_rand m_Random;
+
+		// Reused between frames, see Render
+		Vector<QuadInstance> m_Instances;
 	};
 }
@@ -2,6 +2,7 @@
 #include "RenderCommand.h"
 
 #include "Platform/OpenGL/OpenGLRendererAPI.h"
+#include "Platform/Null/NullRendererAPI.h"
 
 namespace OverEngine
 {
@@ -9,7 +10,7 @@ namespace OverEngine
 	{
 		switch (RendererAPI::GetAPI())
 		{
-		case RendererAPI::API::None:    OE_CORE_ASSERT(false, "RendererAPI::None is currently not supported!"); return nullptr;
+		case RendererAPI::API::None:    return new NullRendererAPI();
 		case RendererAPI::API::OpenGL:  return new OpenGLRendererAPI();
 		}
 
@@ -17,8 +18,22 @@ namespace OverEngine
 		return nullptr;
 	}
 
-	RendererAPI* RenderCommand::s_RendererAPI = CreateRendererAPI();
+	RendererAPI* RenderCommand::s_RendererAPI = nullptr;
 
 	uint32_t RenderCommand::s_MaxTextureSize = 0;
 	uint32_t RenderCommand::s_MaxTextureSlotCount = 0;
+
+	bool RenderCommand::s_DepthTesting = false;
+
+	void RenderCommand::Init()
+	{
+		// Created here rather than statically, so RendererAPI::SetAPI can be called before
+		delete s_RendererAPI;
+		s_RendererAPI = CreateRendererAPI();
+		s_RendererAPI->Init();
+
+		s_MaxTextureSize = s_RendererAPI->GetMaxTextureSize();
+		s_MaxTextureSlotCount = s_RendererAPI->GetMaxTextureSlotCount();
+		s_DepthTesting = s_RendererAPI->IsDepthTestingEnabled();
+	}
 }
@@ -1,43 +1,77 @@
 #pragma once
 
 #include "RendererAPI.h"
+#include "RenderThread.h"
 
 namespace OverEngine
 {
 	class RenderCommand
 	{
 	public:
-		inline static void Init()
+		static void Init();
+
+		// Runs `func` with the graphics context, recorded for the RenderThread when there's one.
+		// Main or render thread only, see RenderThread::SubmitDeferred for the others.
+		template <typename F>
+		inline static void Submit(F&& func)
 		{
-			s_RendererAPI->Init();
+			OE_CORE_ASSERT(!RenderThread::IsRunning() || RenderThread::IsRecording() || RenderThread::IsRenderThread(),
+				"RenderCommand::Submit called from a thread other than the main and render ones!");
 
-			s_MaxTextureSize = s_RendererAPI->GetMaxTextureSize();
-			s_MaxTextureSlotCount = s_RendererAPI->GetMaxTextureSlotCount();
+			if (RenderThread::IsRecording())
+				RenderThread::GetQueue().Submit(std::forward<F>(func));
+			else
+				func();
 		}
 
 		inline static void SetViewport(uint32_t x, uint32_t y, uint32_t width, uint32_t height)
 		{
-			s_RendererAPI->SetViewport(x, y, width, height);
+			Submit([=]() { s_RendererAPI->SetViewport(x, y, width, height); });
 		}
 
 		inline static void SetClearColor(const Math::Color& color)
 		{
-			s_RendererAPI->SetClearColor(color);
+			Submit([color]() { s_RendererAPI->SetClearColor(color); });
 		}
 
 		inline static void SetClearDepth(float depth)
 		{
-			s_RendererAPI->SetClearDepth(depth);
+			Submit([depth]() { s_RendererAPI->SetClearDepth(depth); });
 		}
 
 		inline static void Clear(const ClearFlags& flags = ClearFlags_ClearColor | ClearFlags_ClearDepth)
 		{
-			s_RendererAPI->Clear(flags);
+			Submit([flags]() { s_RendererAPI->Clear(flags); });
 		}
 
 		inline static void DrawIndexed(const Ref<VertexArray>& vertexArray, uint32_t indexCount = 0, DrawType drawType = DrawType::Triangles)
 		{
-			s_RendererAPI->DrawIndexed(vertexArray, indexCount, drawType);
+			Submit([=]() { s_RendererAPI->DrawIndexed(vertexArray, indexCount, drawType); });
+		}
+
+		inline static void DrawArrays(const Ref<VertexArray>& vertexArray, uint32_t first, uint32_t count, DrawType drawType = DrawType::Triangles)
+		{
+			Submit([=]() { s_RendererAPI->DrawArrays(vertexArray, first, count, drawType); });
+		}
+
+		inline static void DrawInstanced(const Ref<VertexArray>& vertexArray, uint32_t vertexCount, uint32_t instanceCount, uint32_t baseInstance = 0, DrawType drawType = DrawType::Triangles)
+		{
+			Submit([=]() { s_RendererAPI->DrawInstanced(vertexArray, vertexCount, instanceCount, baseInstance, drawType); });
+		}
+
+		inline static void DrawIndirect(const Ref<VertexArray>& vertexArray, const Ref<StorageBuffer>& commands, uint32_t offset = 0, DrawType drawType = DrawType::Triangles)
+		{
+			Submit([=]() { s_RendererAPI->DrawIndirect(vertexArray, commands, offset, drawType); });
+		}
+
+		inline static void DispatchCompute(uint32_t groupCountX, uint32_t groupCountY = 1, uint32_t groupCountZ = 1)
+		{
+			Submit([=]() { s_RendererAPI->DispatchCompute(groupCountX, groupCountY, groupCountZ); });
+		}
+
+		inline static void Barrier(BarrierFlags flags)
+		{
+			Submit([flags]() { s_RendererAPI->Barrier(flags); });
 		}
 
 		inline static uint32_t GetMaxTextureSize()
@@ -50,19 +84,22 @@ namespace OverEngine
 			return s_MaxTextureSlotCount;
 		}
 
+		// As last set through RenderCommand, the GPU may not have reached it yet
 		inline static bool IsDepthTestingEnabled()
 		{
-			return s_RendererAPI->IsDepthTestingEnabled();
+			return s_DepthTesting;
 		}
 
 		inline static void DisableDepthTesting()
 		{
-			s_RendererAPI->DisableDepthTesting();
+			s_DepthTesting = false;
+			Submit([]() { s_RendererAPI->DisableDepthTesting(); });
 		}
 
 		inline static void EnableDepthTesting()
 		{
-			s_RendererAPI->EnableDepthTesting();
+			s_DepthTesting = true;
+			Submit([]() { s_RendererAPI->EnableDepthTesting(); });
 		}
 
 		inline static void SetDepthTesting(bool isEnabled)
@@ -76,10 +113,54 @@ namespace OverEngine
 			DisableDepthTesting();
 		}
 
+		inline static void DisableDepthWriting()
+		{
+			Submit([]() { s_RendererAPI->DisableDepthWriting(); });
+		}
+
+		inline static void EnableDepthWriting()
+		{
+			Submit([]() { s_RendererAPI->EnableDepthWriting(); });
+		}
+
+		inline static void SetDepthWriting(bool isEnabled)
+		{
+			if (isEnabled)
+			{
+				EnableDepthWriting();
+				return;
+			}
+
+			DisableDepthWriting();
+		}
+
+		inline static void DisableBlending()
+		{
+			Submit([]() { s_RendererAPI->DisableBlending(); });
+		}
+
+		inline static void EnableBlending()
+		{
+			Submit([]() { s_RendererAPI->EnableBlending(); });
+		}
+
+		inline static void SetBlending(bool isEnabled)
+		{
+			if (isEnabled)
+			{
+				EnableBlending();
+				return;
+			}
+
+			DisableBlending();
+		}
+
 	private:
 		static RendererAPI* s_RendererAPI;
 
 		static uint32_t s_MaxTextureSize;
 		static uint32_t s_MaxTextureSlotCount;
+
+		static bool s_DepthTesting;
 	};
 }
@@ -0,0 +1,78 @@
+#include "pcheader.h"
+#include "RenderCommandQueue.h"
+
+namespace OverEngine
+{
+	// Precedes every command in a block, the command is stored right after it
+	struct RenderCommandHeader
+	{
+		void(*Func)(void*, bool);
+		uint32_t Size; // Of the header and the command, keeps the next header aligned
+	};
+
+	static constexpr uint32_t CommandAlignment = (uint32_t)alignof(std::max_align_t);
+	static constexpr uint32_t HeaderSize = ((uint32_t)sizeof(RenderCommandHeader) + CommandAlignment - 1) / CommandAlignment * CommandAlignment;
+
+	RenderCommandQueue::RenderCommandQueue(uint32_t blockSize)
+		: m_BlockSize(blockSize)
+	{
+	}
+
+	RenderCommandQueue::~RenderCommandQueue()
+	{
+		Clear();
+	}
+
+	void RenderCommandQueue::Execute()
+	{
+		Release(true);
+	}
+
+	void RenderCommandQueue::Clear()
+	{
+		Release(false);
+	}
+
+	void* RenderCommandQueue::Allocate(uint32_t size, CommandFn func)
+	{
+		uint32_t totalSize = (HeaderSize + size + CommandAlignment - 1) / CommandAlignment * CommandAlignment;
+
+		// Skip to the next block (reusing it if possible) when this one is full
+		while (m_CurrentBlock < (uint32_t)m_Blocks.size() && m_Blocks[m_CurrentBlock].Used + totalSize > m_Blocks[m_CurrentBlock].Size)
+			m_CurrentBlock++;
+
+		if (m_CurrentBlock == (uint32_t)m_Blocks.size())
+		{
+			Block& block = m_Blocks.emplace_back();
+			block.Size = std::max(m_BlockSize, totalSize);
+			block.Data = CreateScope<uint8_t[]>(block.Size);
+		}
+
+		Block& block = m_Blocks[m_CurrentBlock];
+		uint8_t* header = block.Data.get() + block.Used;
+		block.Used += totalSize;
+
+		new (header) RenderCommandHeader{ func, totalSize };
+		m_CommandCount++;
+
+		return header + HeaderSize;
+	}
+
+	void RenderCommandQueue::Release(bool execute)
+	{
+		for (Block& block : m_Blocks)
+		{
+			for (uint32_t offset = 0; offset < block.Used;)
+			{
+				auto* header = reinterpret_cast<RenderCommandHeader*>(block.Data.get() + offset);
+				header->Func(block.Data.get() + offset + HeaderSize, execute);
+				offset += header->Size;
+			}
+
+			block.Used = 0;
+		}
+
+		m_CurrentBlock = 0;
+		m_CommandCount = 0;
+	}
+}
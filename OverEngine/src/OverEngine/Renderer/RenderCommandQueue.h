@@ -0,0 +1,68 @@
+#pragma once
+
+#include "OverEngine/Core/Core.h"
+
+#include <new>
+#include <type_traits>
+
+namespace OverEngine
+{
+	/**
+	 * Records callables to run later in submission order, see RenderThread.
+	 * Commands are stored inline in large blocks, so recording one is a
+	 * bump allocation and a move. The memory is kept between frames.
+	 */
+	class RenderCommandQueue
+	{
+	public:
+		RenderCommandQueue(uint32_t blockSize = 1024 * 1024);
+		~RenderCommandQueue();
+
+		RenderCommandQueue(const RenderCommandQueue&) = delete;
+		RenderCommandQueue& operator=(const RenderCommandQueue&) = delete;
+
+		template <typename F>
+		void Submit(F&& func)
+		{
+			using Command = std::decay_t<F>;
+			static_assert(alignof(Command) <= alignof(std::max_align_t), "Over aligned render commands are not supported!");
+
+			void* storage = Allocate((uint32_t)sizeof(Command), [](void* data, bool execute)
+			{
+				Command& command = *static_cast<Command*>(data);
+				if (execute)
+					command();
+				command.~Command();
+			});
+
+			new (storage) Command(std::forward<F>(func));
+		}
+
+		// Runs the commands in submission order and releases them
+		void Execute();
+
+		// Releases the commands without running them
+		void Clear();
+
+		inline uint32_t GetCommandCount() const { return m_CommandCount; }
+		inline bool IsEmpty() const { return m_CommandCount == 0; }
+	private:
+		// Runs the command stored at `data` if `execute` is true, then destroys it
+		using CommandFn = void(*)(void* data, bool execute);
+
+		void* Allocate(uint32_t size, CommandFn func);
+		void Release(bool execute);
+	private:
+		struct Block
+		{
+			Scope<uint8_t[]> Data;
+			uint32_t Size = 0;
+			uint32_t Used = 0;
+		};
+
+		Vector<Block> m_Blocks;
+		uint32_t m_CurrentBlock = 0;
+		uint32_t m_BlockSize;
+		uint32_t m_CommandCount = 0;
+	};
+}
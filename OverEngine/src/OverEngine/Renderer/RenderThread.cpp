@@ -0,0 +1,213 @@
+#include "pcheader.h"
+#include "RenderThread.h"
+
+#include "OverEngine/Renderer/GraphicsContext.h"
+
+#include <condition_variable>
+#include <deque>
+#include <mutex>
+#include <thread>
+
+namespace OverEngine
+{
+	struct RenderThreadJob
+	{
+		const std::function<void()>* Func;
+		bool Done = false;
+	};
+
+	struct RenderThreadData
+	{
+		std::thread Thread;
+		std::thread::id ThreadID;
+		std::thread::id MainThreadID;
+		GraphicsContext* Context = nullptr;
+		bool Running = false;
+
+		// One is recorded by the main thread while the other one is executed
+		RenderCommandQueue Queues[2];
+		uint32_t RecordingQueue = 0;
+
+		std::mutex Mutex;
+		std::condition_variable WorkAvailable;
+		std::condition_variable WorkDone;
+
+		bool FramePending = false;
+		bool Stopping = false;
+		std::deque<RenderThreadJob*> Jobs;
+
+		// Submitted by the other threads, waiting for the main thread to record them
+		std::mutex DeferredMutex;
+		Vector<std::function<void()>> Deferred;
+	};
+
+	static RenderThreadData s_RenderThread;
+
+	static void RenderThreadLoop()
+	{
+		s_RenderThread.Context->Current();
+
+		std::unique_lock<std::mutex> lock(s_RenderThread.Mutex);
+		while (true)
+		{
+			s_RenderThread.WorkAvailable.wait(lock, []()
+			{
+				return s_RenderThread.FramePending || !s_RenderThread.Jobs.empty() || s_RenderThread.Stopping;
+			});
+
+			// Jobs first, the main thread is blocked on them
+			while (!s_RenderThread.Jobs.empty())
+			{
+				RenderThreadJob* job = s_RenderThread.Jobs.front();
+				s_RenderThread.Jobs.pop_front();
+
+				lock.unlock();
+				(*job->Func)();
+				lock.lock();
+
+				job->Done = true;
+				s_RenderThread.WorkDone.notify_all();
+			}
+
+			if (s_RenderThread.FramePending)
+			{
+				// Only touched by this thread while the frame is pending
+				RenderCommandQueue& queue = s_RenderThread.Queues[1 - s_RenderThread.RecordingQueue];
+
+				lock.unlock();
+				queue.Execute();
+				lock.lock();
+
+				s_RenderThread.FramePending = false;
+				s_RenderThread.WorkDone.notify_all();
+				continue;
+			}
+
+			if (s_RenderThread.Stopping)
+				break;
+		}
+
+		s_RenderThread.Context->Release();
+	}
+
+	void RenderThread::Start(GraphicsContext* context)
+	{
+		OE_CORE_ASSERT(!s_RenderThread.Running, "RenderThread is already running!");
+
+		context->Release();
+
+		std::lock_guard<std::mutex> lock(s_RenderThread.Mutex);
+		s_RenderThread.Context = context;
+		s_RenderThread.Stopping = false;
+		s_RenderThread.Running = true;
+		s_RenderThread.Thread = std::thread(RenderThreadLoop);
+		s_RenderThread.ThreadID = s_RenderThread.Thread.get_id();
+		s_RenderThread.MainThreadID = std::this_thread::get_id();
+	}
+
+	void RenderThread::Stop()
+	{
+		if (!s_RenderThread.Running)
+			return;
+
+		Flush();
+
+		{
+			std::lock_guard<std::mutex> lock(s_RenderThread.Mutex);
+			s_RenderThread.Stopping = true;
+		}
+		s_RenderThread.WorkAvailable.notify_one();
+		s_RenderThread.Thread.join();
+
+		s_RenderThread.Running = false;
+		s_RenderThread.ThreadID = std::thread::id();
+		s_RenderThread.MainThreadID = std::thread::id();
+		s_RenderThread.Context->Current();
+
+		// Submitted after the last Kick
+		Vector<std::function<void()>> deferred;
+		{
+			std::lock_guard<std::mutex> lock(s_RenderThread.DeferredMutex);
+			deferred.swap(s_RenderThread.Deferred);
+		}
+		for (auto& func : deferred)
+			func();
+	}
+
+	bool RenderThread::IsRunning()
+	{
+		return s_RenderThread.Running;
+	}
+
+	bool RenderThread::IsRecording()
+	{
+		return s_RenderThread.Running && std::this_thread::get_id() == s_RenderThread.MainThreadID;
+	}
+
+	bool RenderThread::IsRenderThread()
+	{
+		return s_RenderThread.Running && std::this_thread::get_id() == s_RenderThread.ThreadID;
+	}
+
+	void RenderThread::SubmitDeferred(std::function<void()> func)
+	{
+		std::lock_guard<std::mutex> lock(s_RenderThread.DeferredMutex);
+		s_RenderThread.Deferred.push_back(std::move(func));
+	}
+
+	RenderCommandQueue& RenderThread::GetQueue()
+	{
+		return s_RenderThread.Queues[s_RenderThread.RecordingQueue];
+	}
+
+	void RenderThread::Kick()
+	{
+		if (!s_RenderThread.Running)
+			return;
+
+		{
+			std::lock_guard<std::mutex> lock(s_RenderThread.DeferredMutex);
+			for (auto& func : s_RenderThread.Deferred)
+				GetQueue().Submit(std::move(func));
+			s_RenderThread.Deferred.clear();
+		}
+
+		std::unique_lock<std::mutex> lock(s_RenderThread.Mutex);
+		s_RenderThread.WorkDone.wait(lock, []() { return !s_RenderThread.FramePending; });
+
+		s_RenderThread.RecordingQueue = 1 - s_RenderThread.RecordingQueue;
+		s_RenderThread.FramePending = true;
+
+		lock.unlock();
+		s_RenderThread.WorkAvailable.notify_one();
+	}
+
+	void RenderThread::Flush()
+	{
+		if (!s_RenderThread.Running)
+			return;
+
+		Kick();
+
+		std::unique_lock<std::mutex> lock(s_RenderThread.Mutex);
+		s_RenderThread.WorkDone.wait(lock, []() { return !s_RenderThread.FramePending; });
+	}
+
+	void RenderThread::ExecuteSync(const std::function<void()>& func)
+	{
+		// Other threads wait for the render thread too, the context isn't theirs
+		if (!s_RenderThread.Running || IsRenderThread())
+		{
+			func();
+			return;
+		}
+
+		RenderThreadJob job{ &func };
+
+		std::unique_lock<std::mutex> lock(s_RenderThread.Mutex);
+		s_RenderThread.Jobs.push_back(&job);
+		s_RenderThread.WorkAvailable.notify_one();
+
+		s_RenderThread.WorkDone.wait(lock, [&job]() { return job.Done; });
+	}
+}
@@ -0,0 +1,71 @@
+#pragma once
+
+#include "OverEngine/Core/Core.h"
+#include "OverEngine/Renderer/RenderCommandQueue.h"
+
+#include <functional>
+
+namespace OverEngine
+{
+	class GraphicsContext;
+
+	/**
+	 * Thread owning the graphics context, executing frame N while the main thread records frame N + 1.
+	 *
+	 * While it runs, RenderCommand and Renderer2D calls made on the main thread are recorded
+	 * instead of executed and GPU resources are created and destroyed on it. Anything else
+	 * touching the GPU (uploading to a texture, reloading a shader...) has to go through
+	 * RenderCommand::Submit.
+	 */
+	class RenderThread
+	{
+	public:
+		// Moves `context` from the calling thread to the render thread
+		static void Start(GraphicsContext* context);
+
+		// Executes everything recorded, then gives the context back to the calling thread
+		static void Stop();
+
+		static bool IsRunning();
+
+		// True when called from the main thread while the render thread runs
+		static bool IsRecording();
+
+		static bool IsRenderThread();
+
+		// For threads other than the main one, `func` is recorded by the main thread on its next Kick
+		static void SubmitDeferred(std::function<void()> func);
+
+		// Commands of the frame being recorded, main thread only
+		static RenderCommandQueue& GetQueue();
+
+		// Hands the recorded frame over. Waits for the previous one to be done first,
+		// so the main thread is never more than a frame ahead.
+		static void Kick();
+
+		// Waits for everything recorded so far to be executed
+		static void Flush();
+
+		// Runs `func` on the render thread as soon as it's between two frames and waits for it.
+		// Runs it right away when not recording.
+		static void ExecuteSync(const std::function<void()>& func);
+	};
+
+	// Creates a GPU resource on the render thread and destroys it there once the last reference is gone
+	template <typename T, typename... Args>
+	Ref<T> CreateRenderResource(Args&&... args)
+	{
+		T* resource = nullptr;
+		RenderThread::ExecuteSync([&]() { resource = new T(std::forward<Args>(args)...); });
+
+		return Ref<T>(resource, [](T* resource)
+		{
+			if (RenderThread::IsRecording())
+				RenderThread::GetQueue().Submit([resource]() { delete resource; });
+			else if (RenderThread::IsRunning() && !RenderThread::IsRenderThread())
+				RenderThread::SubmitDeferred([resource]() { delete resource; });
+			else
+				delete resource;
+		});
+	}
+}
@@ -2,6 +2,7 @@
 #include "Renderer.h"
 
 #include "Renderer2D.h"
+#include "FrameBufferPool.h"
 
 namespace OverEngine
 {
@@ -17,6 +18,13 @@ namespace OverEngine
 	void Renderer::Shutdown()
 	{
 		Renderer2D::Shutdown();
+		FrameBufferPool::Clear();
+	}
+
+	void Renderer::EndFrame()
+	{
+		Renderer2D::EndFrame();
+		FrameBufferPool::EndFrame();
 	}
 
 	void Renderer::OnWindowResize(uint32_t width, uint32_t height)
@@ -45,10 +53,13 @@ namespace OverEngine
 
 	void Renderer::Submit(const Ref<Shader>& shader, const Ref<VertexArray>& vertexArray, const Math::Mat4x4& transform)
 	{
-		shader->Bind();
-		shader->UploadUniformMat4("u_ViewProjMatrix", s_SceneData->ViewProjectionMatrix);
-		shader->UploadUniformMat4("u_Transform", transform);
-		vertexArray->Bind();
-		RenderCommand::DrawIndexed(vertexArray);
+		RenderCommand::Submit([shader, vertexArray, transform, viewProjection = s_SceneData->ViewProjectionMatrix]()
+		{
+			shader->Bind();
+			shader->UploadUniformMat4("u_ViewProjMatrix", viewProjection);
+			shader->UploadUniformMat4("u_Transform", transform);
+			vertexArray->Bind();
+			RenderCommand::DrawIndexed(vertexArray);
+		});
 	}
 }
@@ -13,6 +13,9 @@ namespace OverEngine
 		static void Init();
 		static void Shutdown();
 
+		// Called by the Application once all layers have rendered, before swapping buffers
+		static void EndFrame();
+
 		static void OnWindowResize(uint32_t width, uint32_t height);
 
 		static void BeginScene(const Mat4x4& viewProjectionMatrix);
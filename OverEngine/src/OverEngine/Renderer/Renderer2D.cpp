@@ -2,108 +2,611 @@
 #include "Renderer2D.h"
 
 #include "Texture.h"
+#include "TimerQuery.h"
+#include "RenderThread.h"
+
+#include <glm/gtc/packing.hpp>
+#include <chrono>
+#include <mutex>
 
 namespace OverEngine
 {
-	Renderer2D::Statistics Renderer2D::s_Statistics;
+	// Must match the defines in BatchRenderer2D.glsl
+	// Slots [0, MaxTextureSlotCount) are Texture2Ds, the next MaxTextureSlotCount are Texture2DArrays
+	enum QuadFlags : uint32_t
+	{
+		QuadFlags_NoTexture  = 0xFF,
+		QuadFlags_SlotMask   = 0xFF,
+		QuadFlags_LayerShift = 8,
+		QuadFlags_LayerMask  = 0xFFF << QuadFlags_LayerShift,
+		QuadFlags_FlipX      = BIT(24),
+		QuadFlags_FlipY      = BIT(25),
+		QuadFlags_Repeat     = BIT(26),
+
+		// Not used by the shader, the quad goes to the opaque queue
+		QuadFlags_Opaque     = BIT(27),
+
+		// Font glyph, the texture's alpha is a distance to the outline
+		QuadFlags_SDF        = BIT(28)
+	};
 
+	// One vertex (or instance) per quad, the shader expands it to four corners.
+	// Everything except the position is packed to keep the upload small (44 bytes per quad).
 	struct Vertex
 	{
-		Vector3 a_Position0 = Vector3(0.0f);
-		Vector3 a_Position1 = Vector3(0.0f);
-		Vector3 a_Position2 = Vector3(0.0f);
-		Vector3 a_Position3 = Vector3(0.0f);
+		// Translation of the quad, z being the depth
+		Vector3  a_Position  = Vector3(0.0f);
+
+		// 2x2 linear part of the transform (column 0 xy, column 1 xy) as 4 halfs
+		uint32_t a_Transform[2] = { 0, 0 };
+
+		// RGBA8
+		uint32_t a_Color = 0xFFFFFFFF;
+
+		// Normalized (x, y, width, height) of the sprite inside the bound texture
+		uint16_t a_TexRect[4] = { 0, 0, 0xFFFF, 0xFFFF };
+
+		// Tiling xy, offset xy as 4 halfs
+		uint32_t a_TexTiling[2] = { 0, 0 };
+
+		// Texture slot, array layer and QuadFlags_*
+		uint32_t a_TexFlags = QuadFlags_NoTexture;
+	};
+
+	static_assert(sizeof(Vertex) == 44, "Vertex is expected to be tightly packed");
+
+	struct LineVertex
+	{
+		Vector3  a_Position;
+		uint32_t a_Color; // RGBA8
+	};
+
+	static_assert(sizeof(LineVertex) == 16, "LineVertex is expected to be tightly packed");
+
+	// One instance per circle, expanded like the instanced quads
+	struct CircleInstance
+	{
+		Vector3  a_Position;
+		uint32_t a_Transform[2]; // Same as Vertex::a_Transform, the circle fills the quad
+		uint32_t a_Color;        // RGBA8
+		float    a_Thickness;    // Ring width relative to the radius
+	};
+
+	static_assert(sizeof(CircleInstance) == 28, "CircleInstance is expected to be tightly packed");
 
-		Color   a_Color     = Color(1.0f);
-		int     a_TexSlot   = -1;
-		Vector4 a_TexCoord  = Vector4(0.0f);
-		Vector4 a_TexRegion = Vector4(0.0f);
-		int     a_TexRepeat = 0;
+	struct QuadSortEntry
+	{
+		uint32_t Key;
+		uint32_t Index;
 	};
 
 	// Hard-coded Limits
-	static constexpr uint32_t MaxTextureCount = 32;
-	static constexpr uint32_t MaxQuadCount = 1000000;
-	
+	static constexpr uint32_t MaxTextureSlotCount = 16; // Per kind (Texture2D & Texture2DArray)
+	static constexpr uint32_t MaxQuadCount = 65536; // Per batch
+	static constexpr uint32_t MinQuadCount = 1024;  // Smallest batch worth starting in the current segment
+	static constexpr uint32_t StreamingSegmentSize = 2 * MaxQuadCount * sizeof(Vertex);
+
+	// Small textures are copied into layers of Texture2DArrays so that many of them only take one slot.
+	// Textures share an array if they have the same size, format and sampling state (a TextureArrayClass).
+	static constexpr uint32_t MaxArrayTextureSize = 512;
+	static constexpr uint32_t MinArrayLayerCount = 4;
+	static constexpr uint32_t MaxArrayLayerCount = 64;
+
+	struct TextureArrayClass
+	{
+		uint32_t Width, Height;
+		TextureFormat Format;
+		TextureFilter Filter;
+		TextureWrap UWrap, VWrap;
+
+		bool operator==(const TextureArrayClass& other) const
+		{
+			return Width == other.Width && Height == other.Height && Format == other.Format &&
+				Filter == other.Filter && UWrap == other.UWrap && VWrap == other.VWrap;
+		}
+	};
+
+	struct TextureArrayPage
+	{
+		TextureArrayClass Class;
+		Ref<Texture2DArray> Array;
+		Vector<uint32_t> FreeLayers;
+	};
+
+	struct TextureArrayEntry
+	{
+		std::weak_ptr<Texture2D> Texture;
+
+		// What was copied into the layer, a reloaded texture has a new one
+		uint32_t RendererID;
+		uint32_t Generation;
+
+		uint32_t Page;
+		uint32_t Layer;
+	};
+
+	// Per batch, in line vertices or circles
+	static constexpr uint32_t MaxPrimitiveCount = 65536;
+	static constexpr uint32_t MinPrimitiveCount = 1024;
+
+	// Lines and circles aren't depth sorted, they're always written straight into their buffer
+	template <typename T>
+	struct PrimitiveBatch
+	{
+		Ref<VertexArray> VA = nullptr;
+		Ref<StreamingVertexBuffer> VB = nullptr;
+		Ref<OverEngine::Shader> Shader = nullptr;
+
+		// Null until something is drawn, then points into VB's mapped memory
+		T* BufferBasePtr = nullptr;
+		T* BufferPtr = nullptr;
+
+		uint32_t Count = 0;
+		uint32_t Capacity = 0;
+	};
+
+	// Frames between recording the timer queries and reading them back, so that reading never stalls
+	static constexpr uint32_t TimerQueryLatency = 3;
+
+	// What a frame recorded, kept until its timer queries are ready
+	struct FrameTimings
+	{
+		Renderer2D::Statistics Statistics;
+
+		// One per batch, Queries[i] timed Statistics.Batches[i]
+		Vector<Ref<TimerQuery>> Queries;
+		uint32_t QueryCount = 0;
+
+		bool Pending = false;
+	};
+
 	struct Renderer2DData
 	{
-		Ref<VertexArray>  QuadVA = nullptr;
-		Ref<VertexBuffer> QuadVB = nullptr;
+		Ref<VertexArray> QuadVA = nullptr;
+		Ref<StreamingVertexBuffer> QuadVB = nullptr;
 
+		// Points into QuadVB's mapped memory, or into QuadStagingBuffer when depth sorting
 		Vertex* QuadBufferBasePtr = nullptr;
 		Vertex* QuadBufferPtr = nullptr;
 
-		uint32_t OpaqueInsertIndex = 0;
+		// Depth sorting needs to read the quads back, which is slow on mapped memory.
+		// So quads are written here, sorted and copied into the QuadVB once.
+		Vertex* QuadStagingBuffer = nullptr;
+		QuadSortEntry* SortEntries = nullptr; // 2 * MaxQuadCount, second half is used as scratch by RadixSort
 
 		uint32_t QuadCount = 0;
+		uint32_t QuadCapacity = 0;
 		uint8_t TextureCount = 0;
+		uint8_t TextureArrayCount = 0;
+		uint8_t TextureSlotCount = MaxTextureSlotCount;
 
 		Ref<OverEngine::Shader> Shader = nullptr;
+		QuadRenderPath RenderPath;
+
+		PrimitiveBatch<LineVertex> Lines;
+		PrimitiveBatch<CircleInstance> Circles;
+
+		std::array<Ref<Texture2D>, MaxTextureSlotCount> TextureBindList;
+		std::array<Ref<Texture2DArray>, MaxTextureSlotCount> TextureArrayBindList;
 
-		std::array<Ref<Texture2D>, MaxTextureCount> TextureBindList;
+		// Most sprites are submitted in runs sharing the same texture
+		const Texture2D* LastTexture = nullptr;
+		uint32_t LastTextureFlags = 0;
+
+		Vector<TextureArrayPage> TextureArrayPages;
+		UnorderedMap<const Texture2D*, TextureArrayEntry> TextureArrayEntries;
+
+		// (Page, Layer) of dead textures, freed at the end of the frame once nothing in flight uses them
+		Vector<std::pair<uint32_t, uint32_t>> ReleasedArrayLayers;
 
 		Mat4x4 ViewProjectionMatrix;
 		bool DepthSorting;
+
+		std::array<FrameTimings, TimerQueryLatency> Frames;
+		uint32_t FrameIndex = 0;
+
+		// Accumulated over the current frame
+		Renderer2D::Statistics Statistics;
+
+		// Latest frame read back, see Renderer2D::GetStatistics
+		Renderer2D::Statistics FrameStatistics;
+		std::mutex FrameStatisticsMutex;
+
+		std::chrono::steady_clock::time_point SceneBeginTime;
 	};
 
 	static Renderer2DData* s_Data;
 
-	void Renderer2D::Init()
+	// While the RenderThread runs, s_Data belongs to it. Consecutive quads drawn on the main thread
+	// are packed here and handed over as one command, everything else is recorded as is.
+	static Renderer2D::SubmissionContext* s_RecordedQuads;
+
+	static void SubmitRecordedQuads()
 	{
-		s_Data = new Renderer2DData();
+		if (s_RecordedQuads->GetQuadCount() == 0)
+			return;
 
-		s_Data->QuadVA = VertexArray::Create();
+		RenderThread::GetQueue().Submit([quads = std::move(*s_RecordedQuads)]() { Renderer2D::Submit(quads); });
+		s_RecordedQuads->Clear();
+	}
 
-		s_Data->QuadVB = VertexBuffer::Create();
-		s_Data->QuadVB->AllocateStorage(MaxQuadCount * sizeof(Vertex));
-		s_Data->QuadVB->SetLayout({
-			{ ShaderDataType::Float3, "a_Position0" },
-			{ ShaderDataType::Float3, "a_Position1" },
-			{ ShaderDataType::Float3, "a_Position2" },
-			{ ShaderDataType::Float3, "a_Position3" },
-
-			{ ShaderDataType::Float4, "a_Color" },
-			{ ShaderDataType::Int, "a_TexSlot" },
-			{ ShaderDataType::Float4, "a_TexCoord" },
-			{ ShaderDataType::Float4, "a_TexRegion" },
-			{ ShaderDataType::Int, "a_TexRepeat" }
-		});
-		s_Data->QuadVA->AddVertexBuffer(s_Data->QuadVB);
+	template <typename F>
+	static void Record(F&& func)
+	{
+		SubmitRecordedQuads();
+		RenderThread::GetQueue().Submit(std::forward<F>(func));
+	}
+
+	static inline float MillisecondsSince(std::chrono::steady_clock::time_point start)
+	{
+		return std::chrono::duration<float, std::milli>(std::chrono::steady_clock::now() - start).count();
+	}
+
+	// Maps a float to an uint32_t which sorts in the same order
+	static inline uint32_t DepthSortKey(float depth)
+	{
+		uint32_t bits;
+		memcpy(&bits, &depth, sizeof(float));
+		return (bits & 0x80000000u) ? ~bits : (bits | 0x80000000u);
+	}
+
+	// LSD radix sort over 8-bit digits, returns either `entries` or `scratch` depending on which one ends up sorted
+	static const QuadSortEntry* RadixSort(QuadSortEntry* entries, QuadSortEntry* scratch, uint32_t count)
+	{
+		if (count == 0)
+			return entries;
+
+		uint32_t histograms[4][256] = {};
+		for (uint32_t i = 0; i < count; i++)
+		{
+			uint32_t key = entries[i].Key;
+			histograms[0][key & 0xFF]++;
+			histograms[1][(key >> 8) & 0xFF]++;
+			histograms[2][(key >> 16) & 0xFF]++;
+			histograms[3][key >> 24]++;
+		}
 
+		QuadSortEntry* src = entries;
+		QuadSortEntry* dst = scratch;
+		for (uint32_t pass = 0; pass < 4; pass++)
 		{
-			auto quadIB = IndexBuffer::Create();
-			uint32_t* indices = new uint32_t[MaxQuadCount];
+			uint32_t shift = pass * 8;
+			uint32_t* histogram = histograms[pass];
 
-			for (uint32_t i = 0; i < MaxQuadCount; i++)
-				indices[i] = i;
+			// All keys share this digit (common for the high bytes of depths)
+			if (histogram[(src[0].Key >> shift) & 0xFF] == count)
+				continue;
+
+			uint32_t offsets[256];
+			uint32_t sum = 0;
+			for (uint32_t d = 0; d < 256; d++)
+			{
+				offsets[d] = sum;
+				sum += histogram[d];
+			}
 
-			quadIB->BufferData(indices, MaxQuadCount);
-			delete[] indices;
+			for (uint32_t i = 0; i < count; i++)
+				dst[offsets[(src[i].Key >> shift) & 0xFF]++] = src[i];
 
-			s_Data->QuadVA->SetIndexBuffer(quadIB);
+			std::swap(src, dst);
 		}
 
-		s_Data->QuadBufferBasePtr = new Vertex[MaxQuadCount];
-		s_Data->QuadBufferPtr = s_Data->QuadBufferBasePtr;
+		return src;
+	}
+
+	static BufferLayout GetQuadLayout(QuadRenderPath path)
+	{
+		BufferLayout layout = {
+			{ ShaderDataType::Float3,  "a_Position"        },
+			{ ShaderDataType::Half4,   "a_Transform"       },
+			{ ShaderDataType::UByte4,  "a_Color",     true },
+			{ ShaderDataType::UShort4, "a_TexRect",   true },
+			{ ShaderDataType::Half4,   "a_TexTiling"       },
+			{ ShaderDataType::UInt,    "a_TexFlags"        }
+		};
+		layout.SetPerInstance(path == QuadRenderPath::Instanced);
+		return layout;
+	}
+
+	// Draws `quadCount` quads from `vertexArray` starting at `firstQuad`, expects the shader and textures to be bound
+	static void DrawQuadRange(const Ref<VertexArray>& vertexArray, uint32_t firstQuad, uint32_t quadCount)
+	{
+		auto& stats = s_Data->Statistics;
+
+		if (s_Data->RenderPath == QuadRenderPath::Instanced)
+		{
+			RenderCommand::DrawInstanced(vertexArray, 4, quadCount, firstQuad, DrawType::TriangleStrip);
+			stats.VertexCount += 4 * quadCount;
+		}
+		else
+		{
+			RenderCommand::DrawArrays(vertexArray, firstQuad, quadCount, DrawType::Points);
+			stats.VertexCount += quadCount;
+		}
+
+		stats.DrawCalls++;
+	}
+
+	// Starts timing a batch, every BeginBatch must be followed by an EndBatch
+	static void BeginBatch()
+	{
+		auto& frame = s_Data->Frames[s_Data->FrameIndex];
+		if (frame.QueryCount == frame.Queries.size())
+			frame.Queries.push_back(TimerQuery::Create());
+
+		frame.Queries[frame.QueryCount++]->Begin();
+	}
+
+	static void EndBatch(BatchBreakReason reason, BatchPrimitive primitive, uint32_t count, uint32_t drawCalls)
+	{
+		auto& frame = s_Data->Frames[s_Data->FrameIndex];
+		frame.Queries[frame.QueryCount - 1]->End();
+
+		auto& stats = s_Data->Statistics;
+		stats.Batches.push_back({ reason, primitive, count, drawCalls, -1.0f });
+		stats.BatchBreaks[(size_t)reason]++;
+	}
+
+	////////////////////////////////////////////////////////
+	/// Primitive Batches //////////////////////////////////
+	////////////////////////////////////////////////////////
+
+	template <typename T>
+	static void InitPrimitiveBatch(PrimitiveBatch<T>& batch, const BufferLayout& layout, const char* shaderPath)
+	{
+		batch.VA = VertexArray::Create();
+
+		batch.VB = StreamingVertexBuffer::Create(2 * MaxPrimitiveCount * sizeof(T));
+		batch.VB->SetLayout(layout);
+		batch.VA->AddVertexBuffer(batch.VB);
+
+		batch.Shader = Shader::Create(shaderPath);
+	}
+
+	template <typename T>
+	static void ResetPrimitiveBatch(PrimitiveBatch<T>& batch)
+	{
+		batch.BufferBasePtr = nullptr;
+		batch.BufferPtr = nullptr;
+		batch.Count = 0;
+		batch.Capacity = 0;
+	}
+
+	// Commits the pending primitives, binds what's needed to draw them and returns the first one's index
+	template <typename T>
+	static uint32_t CommitPrimitiveBatch(PrimitiveBatch<T>& batch)
+	{
+		uint32_t dataSize = batch.Count * sizeof(T);
+		uint32_t first = batch.VB->Commit(dataSize) / sizeof(T);
+		s_Data->Statistics.BytesUploaded += dataSize;
+
+		batch.VA->Bind();
+		batch.Shader->Bind();
+		batch.Shader->UploadUniformMat4("u_ViewProjMatrix", s_Data->ViewProjectionMatrix);
+
+		return first;
+	}
+
+	static void FlushLines(BatchBreakReason reason)
+	{
+		auto& lines = s_Data->Lines;
+		if (lines.Count == 0)
+			return;
+
+		auto& stats = s_Data->Statistics;
+		uint32_t first = CommitPrimitiveBatch(lines);
+
+		BeginBatch();
+		RenderCommand::DrawArrays(lines.VA, first, lines.Count, DrawType::Lines);
+		stats.VertexCount += lines.Count;
+		stats.DrawCalls++;
+		EndBatch(reason, BatchPrimitive::Lines, lines.Count / 2, 1);
+
+		ResetPrimitiveBatch(lines);
+	}
+
+	static void FlushCircles(BatchBreakReason reason)
+	{
+		auto& circles = s_Data->Circles;
+		if (circles.Count == 0)
+			return;
+
+		auto& stats = s_Data->Statistics;
+		uint32_t first = CommitPrimitiveBatch(circles);
+
+		BeginBatch();
+		RenderCommand::DrawInstanced(circles.VA, 4, circles.Count, first, DrawType::TriangleStrip);
+		stats.VertexCount += 4 * circles.Count;
+		stats.DrawCalls++;
+		EndBatch(reason, BatchPrimitive::Circles, circles.Count, 1);
+
+		ResetPrimitiveBatch(circles);
+	}
+
+	// Returns room for `count` more, the pending ones are drawn first if they don't leave enough
+	template <typename T>
+	static T* AllocatePrimitives(PrimitiveBatch<T>& batch, uint32_t count, void (*flush)(BatchBreakReason))
+	{
+		if (batch.Count + count > batch.Capacity)
+		{
+			flush(BatchBreakReason::BufferFull);
+
+			uint32_t available;
+			batch.BufferBasePtr = (T*)batch.VB->Reserve(MinPrimitiveCount * sizeof(T), available);
+			batch.BufferPtr = batch.BufferBasePtr;
+			batch.Capacity = std::min(available / (uint32_t)sizeof(T), MaxPrimitiveCount);
+		}
+
+		T* ptr = batch.BufferPtr;
+		batch.BufferPtr += count;
+		batch.Count += count;
+		return ptr;
+	}
+
+	void Renderer2D::Init(QuadRenderPath path)
+	{
+		s_Data = new Renderer2DData();
+		s_RecordedQuads = new SubmissionContext();
+		s_Data->RenderPath = path;
+
+		s_Data->QuadVA = VertexArray::Create();
+
+		s_Data->QuadVB = StreamingVertexBuffer::Create(StreamingSegmentSize);
+		s_Data->QuadVB->SetLayout(GetQuadLayout(path));
+		s_Data->QuadVA->AddVertexBuffer(s_Data->QuadVB);
+
+		s_Data->QuadStagingBuffer = new Vertex[MaxQuadCount];
+		s_Data->SortEntries = new QuadSortEntry[2 * MaxQuadCount];
+
+		if (path == QuadRenderPath::Instanced)
+			s_Data->Shader = Shader::Create("assets/shaders/BatchRenderer2DInstanced.glsl");
+		else
+			s_Data->Shader = Shader::Create("assets/shaders/BatchRenderer2D.glsl");
 
-		s_Data->Shader = Shader::Create("assets/shaders/BatchRenderer2D.glsl");
 		{
-			int textureIDs[MaxTextureCount];
+			int textureIDs[2 * MaxTextureSlotCount];
 
-			for (int i = 0; i < (int)MaxTextureCount; i++)
+			for (int i = 0; i < (int)(2 * MaxTextureSlotCount); i++)
 				textureIDs[i] = i;
 
 			s_Data->Shader->Bind();
-			s_Data->Shader->UploadUniformIntArray("u_Slots", textureIDs, MaxTextureCount);
+			s_Data->Shader->UploadUniformIntArray("u_Slots", textureIDs, MaxTextureSlotCount);
+			s_Data->Shader->UploadUniformIntArray("u_ArraySlots", textureIDs + MaxTextureSlotCount, MaxTextureSlotCount);
 		}
 
-		s_Statistics.Reset();
+		s_Data->TextureSlotCount = (uint8_t)std::min(RenderCommand::GetMaxTextureSlotCount() / 2, MaxTextureSlotCount);
+
+		InitPrimitiveBatch(s_Data->Lines, {
+			{ ShaderDataType::Float3, "a_Position"    },
+			{ ShaderDataType::UByte4, "a_Color", true }
+		}, "assets/shaders/BatchRenderer2DLine.glsl");
+
+		// Always instanced, whatever the quads' render path is
+		BufferLayout circleLayout = {
+			{ ShaderDataType::Float3, "a_Position"        },
+			{ ShaderDataType::Half4,  "a_Transform"       },
+			{ ShaderDataType::UByte4, "a_Color",     true },
+			{ ShaderDataType::Float,  "a_Thickness"       }
+		};
+		circleLayout.SetPerInstance(true);
+		InitPrimitiveBatch(s_Data->Circles, circleLayout, "assets/shaders/BatchRenderer2DCircle.glsl");
+
+		s_Data->Statistics.Reset();
+		s_Data->FrameStatistics.Reset();
 	}
 
 	void Renderer2D::Shutdown()
 	{
-		delete[] s_Data->QuadBufferBasePtr;
+		TextureRegistry::Clear();
+		TextLayout::ClearCache();
+
+		delete[] s_Data->QuadStagingBuffer;
+		delete[] s_Data->SortEntries;
 		delete s_Data;
+		delete s_RecordedQuads;
+	}
+
+	// Renderer2D::EndFrame's part touching s_Data
+	static void EndRenderFrame()
+	{
+		s_Data->QuadVB->NextFrame();
+		s_Data->Lines.VB->NextFrame();
+		s_Data->Circles.VB->NextFrame();
+
+		// Give the array layers of dead textures back
+		for (auto it = s_Data->TextureArrayEntries.begin(); it != s_Data->TextureArrayEntries.end();)
+		{
+			if (it->second.Texture.expired())
+			{
+				s_Data->ReleasedArrayLayers.push_back({ it->second.Page, it->second.Layer });
+				it = s_Data->TextureArrayEntries.erase(it);
+			}
+			else
+			{
+				++it;
+			}
+		}
+
+		for (const auto& [page, layer] : s_Data->ReleasedArrayLayers)
+			s_Data->TextureArrayPages[page].FreeLayers.push_back(layer);
+		s_Data->ReleasedArrayLayers.clear();
+
+		// Keep this frame's statistics until its timer queries are ready
+		auto& frame = s_Data->Frames[s_Data->FrameIndex];
+		std::swap(frame.Statistics, s_Data->Statistics);
+		frame.Pending = true;
+
+		s_Data->Statistics.Reset();
+
+		// The oldest frame's queries should be done by now, the ones which aren't are left unknown
+		s_Data->FrameIndex = (s_Data->FrameIndex + 1) % TimerQueryLatency;
+		auto& oldest = s_Data->Frames[s_Data->FrameIndex];
+
+		if (oldest.Pending)
+		{
+			auto& stats = oldest.Statistics;
+			for (uint32_t i = 0; i < (uint32_t)stats.Batches.size(); i++)
+			{
+				const auto& query = oldest.Queries[i];
+				if (!query->IsResultAvailable())
+					continue;
+
+				stats.Batches[i].GPUTime = query->GetResult() / 1000000.0f;
+				stats.GPUTime += stats.Batches[i].GPUTime;
+			}
+
+			std::lock_guard<std::mutex> lock(s_Data->FrameStatisticsMutex);
+			std::swap(s_Data->FrameStatistics, stats);
+			oldest.Pending = false;
+		}
+
+		oldest.QueryCount = 0;
+	}
+
+	void Renderer2D::EndFrame()
+	{
+		// The registry and the text layouts are only used on the main thread, quads are packed there
+		TextureRegistry::Update();
+		TextLayout::UpdateCache();
+
+		if (RenderThread::IsRecording())
+			Record(EndRenderFrame);
+		else
+			EndRenderFrame();
+	}
+
+	Renderer2D::Statistics Renderer2D::GetStatistics()
+	{
+		std::lock_guard<std::mutex> lock(s_Data->FrameStatisticsMutex);
+		return s_Data->FrameStatistics;
+	}
+
+	const char* Renderer2D::GetBatchBreakReasonName(BatchBreakReason reason)
+	{
+		switch (reason)
+		{
+		case BatchBreakReason::EndScene:         return "End Scene";
+		case BatchBreakReason::TextureSlotsFull: return "Texture Slots Full";
+		case BatchBreakReason::BufferFull:       return "Buffer Full";
+		case BatchBreakReason::Explicit:         return "Explicit";
+		case BatchBreakReason::StaticBatch:      return "Static Batch";
+		}
+
+		OE_CORE_ASSERT(false, "Unknown BatchBreakReason!");
+		return "Unknown";
+	}
+
+	const char* Renderer2D::GetBatchPrimitiveName(BatchPrimitive primitive)
+	{
+		switch (primitive)
+		{
+		case BatchPrimitive::Quads:   return "Quads";
+		case BatchPrimitive::Lines:   return "Lines";
+		case BatchPrimitive::Circles: return "Circles";
+		}
+
+		OE_CORE_ASSERT(false, "Unknown BatchPrimitive!");
+		return "Unknown";
 	}
 
 	Ref<Shader>& Renderer2D::GetShader()
@@ -111,20 +614,40 @@ namespace OverEngine
 		return s_Data->Shader;
 	}
 
+	QuadRenderPath Renderer2D::GetQuadRenderPath()
+	{
+		return s_Data->RenderPath;
+	}
+
 	void Renderer2D::Reset()
 	{
-		s_Data->QuadBufferPtr = s_Data->QuadBufferBasePtr;
-		s_Data->OpaqueInsertIndex = 0;
+		if (RenderThread::IsRecording())
+		{
+			Record([]() { Reset(); });
+			return;
+		}
+
 		s_Data->QuadCount = 0;
 		s_Data->TextureCount = 0;
+		s_Data->TextureArrayCount = 0;
+		s_Data->LastTexture = nullptr;
 
-		s_Statistics.Reset();
+		ResetPrimitiveBatch(s_Data->Lines);
+		ResetPrimitiveBatch(s_Data->Circles);
 	}
 
 	void Renderer2D::BeginScene(const Mat4x4& viewMatrix, const Camera& camera, bool depthSorting)
 	{
+		if (RenderThread::IsRecording())
+		{
+			// The camera may be gone by the time it runs
+			Record([viewMatrix, camera = Camera(camera.GetProjection()), depthSorting]() { BeginScene(viewMatrix, camera, depthSorting); });
+			return;
+		}
+
 		s_Data->ViewProjectionMatrix = camera.GetProjection() * viewMatrix;
 		s_Data->DepthSorting = depthSorting;
+		s_Data->SceneBeginTime = std::chrono::steady_clock::now();
 
 		Reset();
 		StartBatch();
@@ -132,93 +655,438 @@ namespace OverEngine
 
 	void Renderer2D::EndScene()
 	{
-		Flush();
+		if (RenderThread::IsRecording())
+		{
+			Record([]() { EndScene(); });
+			return;
+		}
+
+		Flush(BatchBreakReason::EndScene);
+		s_Data->Statistics.SubmitTime += MillisecondsSince(s_Data->SceneBeginTime);
 	}
 
 	void Renderer2D::StartBatch()
 	{
+		if (RenderThread::IsRecording())
+		{
+			Record([]() { StartBatch(); });
+			return;
+		}
+
+		if (s_Data->DepthSorting)
+		{
+			s_Data->QuadBufferBasePtr = s_Data->QuadStagingBuffer;
+			s_Data->QuadCapacity = MaxQuadCount;
+		}
+		else
+		{
+			// Write straight into the mapped buffer
+			uint32_t available;
+			s_Data->QuadBufferBasePtr = (Vertex*)s_Data->QuadVB->Reserve(MinQuadCount * sizeof(Vertex), available);
+			s_Data->QuadCapacity = std::min(available / (uint32_t)sizeof(Vertex), MaxQuadCount);
+		}
+
 		s_Data->QuadBufferPtr = s_Data->QuadBufferBasePtr;
-		s_Data->OpaqueInsertIndex = 0;
 		s_Data->QuadCount = 0;
 		s_Data->TextureCount = 0;
+		s_Data->TextureArrayCount = 0;
+		s_Data->LastTexture = nullptr;
 	}
 
-	void Renderer2D::NextBatch()
+	void Renderer2D::NextBatch(BatchBreakReason reason)
 	{
-		Flush();
+		if (RenderThread::IsRecording())
+		{
+			Record([reason]() { NextBatch(reason); });
+			return;
+		}
+
+		FlushQuads(reason);
 		StartBatch();
 	}
 
-	void Renderer2D::Flush()
+	void Renderer2D::Flush(BatchBreakReason reason)
+	{
+		if (RenderThread::IsRecording())
+		{
+			Record([reason]() { Flush(reason); });
+			return;
+		}
+
+		FlushQuads(reason);
+		FlushCircles(reason);
+		FlushLines(reason);
+	}
+
+	void Renderer2D::FlushQuads(BatchBreakReason reason)
 	{
 		// Nothing to draw
 		if (s_Data->QuadCount == 0)
 			return;
 
+		uint32_t dataSize = s_Data->QuadCount * sizeof(Vertex);
+		uint32_t opaqueCount = 0;
+
 		if (s_Data->DepthSorting)
 		{
-			std::sort(s_Data->QuadBufferBasePtr, s_Data->QuadBufferBasePtr + s_Data->QuadCount, [](const Vertex& a, const Vertex& b)
+			auto sortBegin = std::chrono::steady_clock::now();
+
+			// Sort small (key, index) pairs instead of moving whole quads around
+			// Texture slots don't need to be part of the key since all the batch's textures are bound at once,
+			// the radix sort is stable so quads with the same depth keep their submission order.
+			// Opaque quads go first and front to back so they reject as many fragments as possible,
+			// the rest are blended back to front on top of them.
+			QuadSortEntry* entries = s_Data->SortEntries;
+			for (uint32_t i = 0; i < s_Data->QuadCount; i++)
 			{
-				return a.a_Position0.z > b.a_Position0.z;
-			});
+				if (s_Data->QuadBufferBasePtr[i].a_TexFlags & QuadFlags_Opaque)
+					opaqueCount++;
+			}
+
+			QuadSortEntry* opaque = entries;
+			QuadSortEntry* transparent = entries + opaqueCount;
+			for (uint32_t i = 0; i < s_Data->QuadCount; i++)
+			{
+				const Vertex& quad = s_Data->QuadBufferBasePtr[i];
+				uint32_t key = DepthSortKey(quad.a_Position.z);
+
+				if (quad.a_TexFlags & QuadFlags_Opaque)
+					*opaque++ = { ~key, i };
+				else
+					*transparent++ = { key, i };
+			}
+
+			uint32_t transparentCount = s_Data->QuadCount - opaqueCount;
+			const QuadSortEntry* sortedOpaque = RadixSort(entries, entries + MaxQuadCount, opaqueCount);
+			const QuadSortEntry* sortedTransparent = RadixSort(entries + opaqueCount, entries + MaxQuadCount + opaqueCount, transparentCount);
+
+			// Gather into the mapped buffer, writes are sequential
+			uint32_t available;
+			Vertex* dst = (Vertex*)s_Data->QuadVB->Reserve(dataSize, available);
+			for (uint32_t i = 0; i < opaqueCount; i++)
+				*dst++ = s_Data->QuadBufferBasePtr[sortedOpaque[i].Index];
+			for (uint32_t i = 0; i < transparentCount; i++)
+				*dst++ = s_Data->QuadBufferBasePtr[sortedTransparent[i].Index];
+
+			s_Data->Statistics.SortTime += MillisecondsSince(sortBegin);
 		}
 
-		// Upload Data
-		s_Data->QuadVB->BufferSubData((void*)s_Data->QuadBufferBasePtr, s_Data->QuadCount * sizeof(Vertex));
+		uint32_t firstQuad = s_Data->QuadVB->Commit(dataSize) / sizeof(Vertex);
+		s_Data->Statistics.BytesUploaded += dataSize;
 
 		// Bind Textures
 		for (uint8_t i = 0; i < s_Data->TextureCount; i++)
 			s_Data->TextureBindList[i]->Bind(i);
 
+		for (uint8_t i = 0; i < s_Data->TextureArrayCount; i++)
+			s_Data->TextureArrayBindList[i]->Bind(MaxTextureSlotCount + i);
+
 		// Bind VertexArray & Shader
 		s_Data->QuadVA->Bind();
 		s_Data->Shader->Bind();
+		s_Data->Shader->UploadUniformMat4("u_ViewProjMatrix", s_Data->ViewProjectionMatrix);
+
+		// DrawCalls
+		uint32_t drawCalls = s_Data->Statistics.DrawCalls;
+		BeginBatch();
+
+		if (opaqueCount > 0)
+		{
+			RenderCommand::DisableBlending();
+			DrawQuadRange(s_Data->QuadVA, firstQuad, opaqueCount);
+			RenderCommand::EnableBlending();
+		}
+
+		if (opaqueCount < s_Data->QuadCount)
+			DrawQuadRange(s_Data->QuadVA, firstQuad + opaqueCount, s_Data->QuadCount - opaqueCount);
 
-		// DrawCall
-		RenderCommand::DrawIndexed(s_Data->QuadVA, s_Data->QuadCount, DrawType::Points);
-		s_Statistics.DrawCalls++;
+		EndBatch(reason, BatchPrimitive::Quads, s_Data->QuadCount, s_Data->Statistics.DrawCalls - drawCalls);
 	}
 
-	////////////////////////////////////////////////////////
-	/// FlatColor Quad /////////////////////////////////////
-	////////////////////////////////////////////////////////
+	// Only the xy plane of the transform is kept, rotations around x or y
+	// are not meaningful for sprites and the quad is flat on z anyway.
+	static inline Vector4 QuadTransform(const Mat4x4& transform)
+	{
+		return Vector4(transform[0].x, transform[0].y, transform[1].x, transform[1].y);
+	}
 
-	void Renderer2D::DrawQuad(const Vector2& position, float rotation, const Vector2& size, const Color& color)
+	static inline Vector4 QuadTransform(float rotation, const Vector2& size)
 	{
-		DrawQuad(Vector3(position, 0.0f), rotation, size, color);
+		float c = glm::cos(rotation);
+		float s = glm::sin(rotation);
+		return Vector4(c * size.x, s * size.x, -s * size.y, c * size.y);
 	}
 
-	void Renderer2D::DrawQuad(const Vector3& position, float rotation, const Vector2& size, const Color& color)
+	static inline void PackHalf4(uint32_t* dst, const Vector4& value)
 	{
-		Mat4x4 transform =
-			glm::translate(Mat4x4(1.0f), position) *
-			glm::rotate(Mat4x4(1.0f), rotation, Vector3(0, 0, 1)) *
-			glm::scale(Mat4x4(1.0f), Vector3(size, 1.0f));
+		dst[0] = glm::packHalf2x16(Vector2(value.x, value.y));
+		dst[1] = glm::packHalf2x16(Vector2(value.z, value.w));
+	}
 
-		DrawQuad(transform, color);
+	static inline void PackUnorm4(uint16_t* dst, const Vector4& value)
+	{
+		uint32_t xy = glm::packUnorm2x16(Vector2(value.x, value.y));
+		uint32_t zw = glm::packUnorm2x16(Vector2(value.z, value.w));
+		dst[0] = (uint16_t)(xy & 0xFFFF);
+		dst[1] = (uint16_t)(xy >> 16);
+		dst[2] = (uint16_t)(zw & 0xFFFF);
+		dst[3] = (uint16_t)(zw >> 16);
 	}
 
-	void Renderer2D::DrawQuad(const Mat4x4& transform, const Color& color)
+	static inline void PackQuad(Vertex& quad, const Vector4& transform, const Vector3& position, const Color& color)
 	{
-		if (color.a == 0)
-			return;
+		quad.a_Position = position;
+		PackHalf4(quad.a_Transform, transform);
 
-		if (s_Data->QuadCount + 1 >= MaxQuadCount)
-			NextBatch();
+		quad.a_Color = glm::packUnorm4x8(color);
+		quad.a_TexFlags = QuadFlags_NoTexture;
 
-		auto mat = s_Data->ViewProjectionMatrix * transform;
+		if (color.a >= 1.0f)
+			quad.a_TexFlags |= QuadFlags_Opaque;
+	}
 
-		s_Data->QuadBufferPtr->a_Position0 = Vector3(mat * Vector4(-0.5, -0.5, 0.0, 1.0));
-		s_Data->QuadBufferPtr->a_Position1 = Vector3(mat * Vector4( 0.5, -0.5, 0.0, 1.0));
-		s_Data->QuadBufferPtr->a_Position2 = Vector3(mat * Vector4(-0.5,  0.5, 0.0, 1.0));
-		s_Data->QuadBufferPtr->a_Position3 = Vector3(mat * Vector4( 0.5,  0.5, 0.0, 1.0));
+	// Packs everything but the texture slot and layer, `rect` is the sprite's rect inside the texture it's drawn from
+	template <typename Props>
+	static inline void PackQuad(Vertex& quad, const Vector4& transform, const Vector3& position, const Props& props,
+		const Rect& rect, bool atlasRegion, bool opaqueTexture)
+	{
+		uint32_t flags = 0;
+		if (props.Flip & TextureFlip_X)
+			flags |= QuadFlags_FlipX;
+		if (props.Flip & TextureFlip_Y)
+			flags |= QuadFlags_FlipY;
 
-		s_Data->QuadBufferPtr->a_Color = color;
-		s_Data->QuadBufferPtr->a_TexSlot = -1;
+		// Atlas regions stand for whole textures, so tiling them must wrap inside the region
+		bool tiled = props.Tiling != Vector2(1.0f) || props.Offset != Vector2(0.0f);
+		if (props.ForceTile || (tiled && atlasRegion))
+			flags |= QuadFlags_Repeat;
+
+		if (props.Tint.a >= 1.0f && opaqueTexture)
+			flags |= QuadFlags_Opaque;
+
+		quad.a_Position = position;
+		PackHalf4(quad.a_Transform, transform);
+
+		quad.a_Color = glm::packUnorm4x8(props.Tint);
+
+		// Tiling, offset and flipping are applied in the shader
+		PackUnorm4(quad.a_TexRect, rect);
+		PackHalf4(quad.a_TexTiling, Vector4(props.Tiling, props.Offset));
+
+		quad.a_TexFlags = flags;
+	}
+
+	// Returns the texture to take the slot and layer from
+	static inline const Ref<Texture2D>& PackQuad(Vertex& quad, const Vector4& transform, const Vector3& position, const TexturedQuadProps& props)
+	{
+		if (props.Sprite->GetType() == TextureType::SubTexture)
+		{
+			const auto& subTexture = static_cast<const SubTexture2D&>(*props.Sprite);
+			const Ref<Texture2D>& master = subTexture.GetMasterTexture();
+
+			PackQuad(quad, transform, position, props, subTexture.GetRect(), subTexture.IsAtlasRegion(), master->IsOpaque());
+			return master;
+		}
+
+		PackQuad(quad, transform, position, props, Rect(0.0f, 0.0f, 1.0f, 1.0f), false, props.Sprite->IsOpaque());
+		return props.Sprite;
+	}
+
+	// Same as above with everything already resolved by the registry, `entry.Master` is not null
+	static inline const Ref<Texture2D>& PackQuad(Vertex& quad, const Vector4& transform, const Vector3& position, const SpriteQuadProps& props, const TextureRegistry::Entry& entry)
+	{
+		Rect rect = {
+			entry.TexRect.x + props.TexRect.x * entry.TexRect.z,
+			entry.TexRect.y + props.TexRect.y * entry.TexRect.w,
+			props.TexRect.z * entry.TexRect.z,
+			props.TexRect.w * entry.TexRect.w
+		};
+
+		PackQuad(quad, transform, position, props, rect, entry.AtlasRegion, entry.Opaque);
+		return entry.Master;
+	}
+
+	////////////////////////////////////////////////////////
+	/// Textures ///////////////////////////////////////////
+	////////////////////////////////////////////////////////
+
+	static inline TextureArrayClass GetTextureArrayClass(const Ref<Texture2D>& texture)
+	{
+		return {
+			texture->GetWidth(), texture->GetHeight(), texture->GetFormat(),
+			texture->GetFilter(), texture->GetUWrap(), texture->GetVWrap()
+		};
+	}
+
+	// Returns the array layer holding `texture`, adding it if it's small enough, nullptr otherwise
+	static const TextureArrayEntry* GetTextureArrayEntry(const Ref<Texture2D>& texture)
+	{
+		if (texture->GetType() != TextureType::Master || texture->IsReference() || texture->GetFormat() == TextureFormat::None)
+			return nullptr;
+
+		if (texture->GetWidth() > MaxArrayTextureSize || texture->GetHeight() > MaxArrayTextureSize)
+			return nullptr;
+
+		TextureArrayClass textureClass = GetTextureArrayClass(texture);
+
+		auto it = s_Data->TextureArrayEntries.find(texture.get());
+		if (it != s_Data->TextureArrayEntries.end())
+		{
+			// A live entry at this address is this texture, but its pixels or sampling state may have changed since
+			const TextureArrayEntry& entry = it->second;
+			if (!entry.Texture.expired() && entry.RendererID == texture->GetRendererID() && entry.Generation == texture->GetGeneration() &&
+				s_Data->TextureArrayPages[entry.Page].Class == textureClass)
+			{
+				return &it->second;
+			}
+
+			s_Data->ReleasedArrayLayers.push_back({ it->second.Page, it->second.Layer });
+			s_Data->TextureArrayEntries.erase(it);
+		}
+
+		uint32_t pageIndex = (uint32_t)s_Data->TextureArrayPages.size();
+		uint32_t classPageCount = 0;
+		for (uint32_t i = 0; i < (uint32_t)s_Data->TextureArrayPages.size(); i++)
+		{
+			const auto& page = s_Data->TextureArrayPages[i];
+			if (!(page.Class == textureClass))
+				continue;
+
+			if (!page.FreeLayers.empty())
+			{
+				pageIndex = i;
+				break;
+			}
+
+			classPageCount++;
+		}
+
+		if (pageIndex == (uint32_t)s_Data->TextureArrayPages.size())
+		{
+			// Every new page of a class is twice as big as the previous one
+			uint32_t layerCount = std::min(MinArrayLayerCount << std::min(classPageCount, 16u), MaxArrayLayerCount);
+
+			TextureArrayPage page;
+			page.Class = textureClass;
+			page.Array = Texture2DArray::Create(textureClass.Width, textureClass.Height, layerCount, textureClass.Format);
+			page.Array->SetFilter(textureClass.Filter);
+			page.Array->SetUWrap(textureClass.UWrap);
+			page.Array->SetVWrap(textureClass.VWrap);
+
+			for (uint32_t layer = layerCount; layer > 0; layer--)
+				page.FreeLayers.push_back(layer - 1);
+
+			s_Data->TextureArrayPages.push_back(std::move(page));
+		}
+
+		auto& page = s_Data->TextureArrayPages[pageIndex];
+		uint32_t layer = page.FreeLayers.back();
+		page.FreeLayers.pop_back();
+
+		page.Array->CopyToLayer(texture, layer);
+
+		auto& entry = s_Data->TextureArrayEntries[texture.get()];
+		entry = { texture, texture->GetRendererID(), texture->GetGeneration(), pageIndex, layer };
+		return &entry;
+	}
+
+	// Returns the slot and layer bits of `texture` for the current batch, starts a new batch if out of slots
+	static uint32_t ResolveTexture(const Ref<Texture2D>& texture)
+	{
+		if (texture.get() == s_Data->LastTexture)
+			return s_Data->LastTextureFlags;
+
+		uint32_t flags;
+		if (const TextureArrayEntry* entry = GetTextureArrayEntry(texture))
+		{
+			const Ref<Texture2DArray>& array = s_Data->TextureArrayPages[entry->Page].Array;
+
+			auto end = s_Data->TextureArrayBindList.begin() + s_Data->TextureArrayCount;
+			auto it = std::find(s_Data->TextureArrayBindList.begin(), end, array);
+
+			uint32_t slot;
+			if (it == end)
+			{
+				if (s_Data->TextureArrayCount == s_Data->TextureSlotCount)
+					Renderer2D::NextBatch(BatchBreakReason::TextureSlotsFull);
+
+				slot = s_Data->TextureArrayCount++;
+				s_Data->TextureArrayBindList[slot] = array;
+			}
+			else
+			{
+				slot = static_cast<uint32_t>(it - s_Data->TextureArrayBindList.begin());
+			}
+
+			flags = (MaxTextureSlotCount + slot) | (entry->Layer << QuadFlags_LayerShift);
+		}
+		else
+		{
+			auto end = s_Data->TextureBindList.begin() + s_Data->TextureCount;
+			auto it = std::find(s_Data->TextureBindList.begin(), end, texture);
+
+			uint32_t slot;
+			if (it == end)
+			{
+				if (s_Data->TextureCount == s_Data->TextureSlotCount)
+					Renderer2D::NextBatch(BatchBreakReason::TextureSlotsFull);
+
+				slot = s_Data->TextureCount++;
+				s_Data->TextureBindList[slot] = texture;
+			}
+			else
+			{
+				slot = static_cast<uint32_t>(it - s_Data->TextureBindList.begin());
+			}
+
+			flags = slot;
+		}
+
+		s_Data->LastTexture = texture.get();
+		s_Data->LastTextureFlags = flags;
+		return flags;
+	}
+
+	////////////////////////////////////////////////////////
+	/// FlatColor Quad /////////////////////////////////////
+	////////////////////////////////////////////////////////
+
+	void Renderer2D::DrawQuad(const Vector2& position, float rotation, const Vector2& size, const Color& color)
+	{
+		DrawQuad(Vector3(position, 0.0f), rotation, size, color);
+	}
+
+	void Renderer2D::DrawQuad(const Vector3& position, float rotation, const Vector2& size, const Color& color)
+	{
+		DrawQuadImpl(QuadTransform(rotation, size), position, color);
+	}
+
+	void Renderer2D::DrawQuad(const Mat4x4& transform, const Color& color)
+	{
+		DrawQuadImpl(QuadTransform(transform), Vector3(transform[3]), color);
+	}
+
+	void Renderer2D::DrawQuadImpl(const Vector4& transform, const Vector3& position, const Color& color)
+	{
+		if (RenderThread::IsRecording())
+		{
+			s_RecordedQuads->DrawQuadImpl(transform, position, color);
+			return;
+		}
+
+		if (color.a == 0)
+			return;
+
+		if (s_Data->QuadCount >= s_Data->QuadCapacity)
+			NextBatch(BatchBreakReason::BufferFull);
+
+		Vertex quad;
+		PackQuad(quad, transform, position, color);
+		*s_Data->QuadBufferPtr = quad;
 
 		s_Data->QuadBufferPtr++;
 		s_Data->QuadCount++;
-		s_Statistics.QuadCount++;
+		s_Data->Statistics.QuadCount++;
 	}
 
 	////////////////////////////////////////////////////////
@@ -232,86 +1100,750 @@ namespace OverEngine
 
 	void Renderer2D::DrawQuad(const Vector3& position, float rotation, const Vector2& size, const TexturedQuadProps& props)
 	{
-		Mat4x4 transform =
-			glm::translate(Mat4x4(1.0f), position) *
-			glm::rotate(Mat4x4(1.0f), rotation, Vector3(0, 0, 1)) *
-			glm::scale(Mat4x4(1.0f), Vector3(size, 1.0f));
-
-		DrawQuad(transform, props);
+		DrawQuadImpl(QuadTransform(rotation, size), position, props);
 	}
 
 	void Renderer2D::DrawQuad(const Mat4x4& transform, const TexturedQuadProps& props)
 	{
+		DrawQuadImpl(QuadTransform(transform), Vector3(transform[3]), props);
+	}
+
+	void Renderer2D::DrawQuadImpl(const Vector4& transform, const Vector3& position, const TexturedQuadProps& props)
+	{
+		if (RenderThread::IsRecording())
+		{
+			s_RecordedQuads->DrawQuadImpl(transform, position, props);
+			return;
+		}
+
 		if (!props.Sprite)
 			return;
 
 		if (props.Tint.a == 0)
 			return;
 
-		if (s_Data->QuadCount + 1 >= MaxQuadCount)
-			NextBatch();
+		if (s_Data->QuadCount >= s_Data->QuadCapacity)
+			NextBatch(BatchBreakReason::BufferFull);
+
+		// Built on the stack since resolving the texture may start a new batch,
+		// also keeps the writes to the mapped buffer sequential
+		Vertex quad;
+		const Ref<Texture2D>& texture = PackQuad(quad, transform, position, props);
+		quad.a_TexFlags |= ResolveTexture(texture);
+		*s_Data->QuadBufferPtr = quad;
+
+		s_Data->QuadBufferPtr++;
+		s_Data->QuadCount++;
+		s_Data->Statistics.QuadCount++;
+	}
 
+	void Renderer2D::DrawQuad(const Mat4x4& transform, const SpriteQuadProps& props)
+	{
+		if (RenderThread::IsRecording())
 		{
-			Ref<Texture2D> gpuTex = (props.Sprite->GetType() == TextureType::SubTexture) ? std::dynamic_pointer_cast<SubTexture2D>(props.Sprite)->GetMasterTexture() : props.Sprite;
+			s_RecordedQuads->DrawQuad(transform, props);
+			return;
+		}
 
-			auto end = s_Data->TextureBindList.begin() + s_Data->TextureCount;
-			auto it = std::find(s_Data->TextureBindList.begin(), end, gpuTex);
-			if (it == end)
+		const TextureRegistry::Entry* entry = TextureRegistry::Get(props.Sprite);
+		if (!entry || !entry->Master)
+		{
+			DrawQuad(transform, props.Tint);
+			return;
+		}
+
+		if (props.Tint.a == 0)
+			return;
+
+		if (s_Data->QuadCount >= s_Data->QuadCapacity)
+			NextBatch(BatchBreakReason::BufferFull);
+
+		Vertex quad;
+		const Ref<Texture2D>& texture = PackQuad(quad, QuadTransform(transform), Vector3(transform[3]), props, *entry);
+		quad.a_TexFlags |= ResolveTexture(texture);
+		*s_Data->QuadBufferPtr = quad;
+
+		s_Data->QuadBufferPtr++;
+		s_Data->QuadCount++;
+		s_Data->Statistics.QuadCount++;
+	}
+
+	////////////////////////////////////////////////////////
+	/// Bulk Quads /////////////////////////////////////////
+	////////////////////////////////////////////////////////
+
+	// Everything the instances of a DrawQuads call share, packed once
+	struct SharedQuadData
+	{
+		// The texture to take the slot and layer from, nullptr for flat colored quads
+		const Ref<Texture2D>* Texture = nullptr;
+
+		Vector4 SpriteRect = Vector4(0, 0, 1, 1);
+
+		// Copied for each instance, its flags are without the slot, layer and opacity
+		Vertex Template;
+		bool Opaque = false;
+	};
+
+	static SharedQuadData PackSharedQuadData(const TexturedQuadProps& props)
+	{
+		SharedQuadData shared;
+		shared.Template.a_TexFlags = QuadFlags_NoTexture;
+		shared.Opaque = props.Tint.a >= 1.0f;
+
+		if (props.Sprite)
+		{
+			shared.Texture = &PackQuad(shared.Template, Vector4(0.0f), Vector3(0.0f), props);
+
+			if (props.Sprite->GetType() == TextureType::SubTexture)
+				shared.SpriteRect = static_cast<const SubTexture2D&>(*props.Sprite).GetRect();
+
+			shared.Template.a_TexFlags &= ~QuadFlags_Opaque;
+			shared.Opaque = shared.Opaque && (*shared.Texture)->IsOpaque();
+		}
+
+		return shared;
+	}
+
+	// Returns false if the instance is invisible. `quad` starts as the template, with the texture slot and layer if known.
+	static inline bool PackQuadInstance(Vertex& quad, const QuadInstance& instance, const SharedQuadData& shared, const Color& sharedTint)
+	{
+		Color tint = sharedTint * instance.Tint;
+		if (tint.a == 0)
+			return false;
+
+		quad.a_Position = instance.Position;
+		PackHalf4(quad.a_Transform, QuadTransform(instance.Rotation, instance.Size));
+		quad.a_Color = glm::packUnorm4x8(tint);
+
+		if (shared.Opaque && tint.a >= 1.0f)
+			quad.a_TexFlags |= QuadFlags_Opaque;
+
+		if (shared.Texture)
+		{
+			Vector4 rect = {
+				shared.SpriteRect.x + instance.TexRect.x * shared.SpriteRect.z,
+				shared.SpriteRect.y + instance.TexRect.y * shared.SpriteRect.w,
+				instance.TexRect.z * shared.SpriteRect.z,
+				instance.TexRect.w * shared.SpriteRect.w
+			};
+
+			PackUnorm4(quad.a_TexRect, rect);
+		}
+
+		return true;
+	}
+
+	void Renderer2D::DrawQuads(Span<const QuadInstance> instances, const TexturedQuadProps& props)
+	{
+		if (instances.empty() || props.Tint.a == 0)
+			return;
+
+		if (RenderThread::IsRecording())
+		{
+			Record([instances = Vector<QuadInstance>(instances.begin(), instances.end()), props]() { DrawQuads(instances, props); });
+			return;
+		}
+
+		SharedQuadData shared = PackSharedQuadData(props);
+
+		size_t next = 0;
+		while (next < instances.size())
+		{
+			if (s_Data->QuadCount >= s_Data->QuadCapacity)
+				NextBatch(BatchBreakReason::BufferFull);
+
+			// May start a new batch too, so the room is computed after it
+			Vertex batchTemplate = shared.Template;
+			if (shared.Texture)
+				batchTemplate.a_TexFlags |= ResolveTexture(*shared.Texture);
+
+			size_t count = std::min<size_t>(instances.size() - next, s_Data->QuadCapacity - s_Data->QuadCount);
+			uint32_t written = 0;
+
+			// Packed on the stack and stored whole, keeping the writes to the mapped buffer sequential
+			for (const QuadInstance& instance : instances.subspan(next, count))
 			{
-				uint8_t slot = s_Data->TextureCount;
-				if (slot + 1u > RenderCommand::GetMaxTextureSlotCount())
-				{
-					NextBatch();
-					slot = 0;
-				}
-				s_Data->TextureBindList[slot] = gpuTex;
-				s_Data->TextureCount++;
-				s_Data->QuadBufferPtr->a_TexSlot = slot;
+				Vertex quad = batchTemplate;
+				if (PackQuadInstance(quad, instance, shared, props.Tint))
+					s_Data->QuadBufferPtr[written++] = quad;
 			}
-			else
+
+			s_Data->QuadBufferPtr += written;
+			s_Data->QuadCount += written;
+			s_Data->Statistics.QuadCount += written;
+
+			next += count;
+		}
+	}
+
+	////////////////////////////////////////////////////////
+	/// Text ///////////////////////////////////////////////
+	////////////////////////////////////////////////////////
+
+	void Renderer2D::DrawText(const Mat4x4& transform, const String& text, const Ref<Font>& font, const Color& color, TextAlignment alignment)
+	{
+		if (text.empty() || color.a == 0)
+			return;
+
+		Ref<Font> usedFont = font ? font : Font::GetDefault();
+		if (!usedFont)
+			return;
+
+		DrawText(transform, TextLayout::Get(usedFont, text, alignment), color);
+	}
+
+	void Renderer2D::DrawText(const Mat4x4& transform, const Ref<TextLayout>& layout, const Color& color)
+	{
+		if (!layout || layout->GetGlyphs().empty() || color.a == 0)
+			return;
+
+		if (RenderThread::IsRecording())
+		{
+			Record([transform, layout, color]() { DrawText(transform, layout, color); });
+			return;
+		}
+
+		const Ref<Texture2D>& atlas = layout->GetFont()->GetAtlas();
+		const auto& glyphs = layout->GetGlyphs();
+
+		// Glyphs are laid out in ems, the transform's axes give the size of an em
+		Vector2 axisX = transform[0];
+		Vector2 axisY = transform[1];
+
+		Vertex shared;
+		shared.a_Color = glm::packUnorm4x8(color);
+		PackHalf4(shared.a_TexTiling, Vector4(1.0f, 1.0f, 0.0f, 0.0f));
+
+		size_t next = 0;
+		while (next < glyphs.size())
+		{
+			if (s_Data->QuadCount >= s_Data->QuadCapacity)
+				NextBatch(BatchBreakReason::BufferFull);
+
+			shared.a_TexFlags = ResolveTexture(atlas) | QuadFlags_SDF;
+
+			size_t count = std::min<size_t>(glyphs.size() - next, s_Data->QuadCapacity - s_Data->QuadCount);
+			for (size_t i = 0; i < count; i++)
 			{
-				s_Data->QuadBufferPtr->a_TexSlot = static_cast<int>(it - s_Data->TextureBindList.begin());
+				const TextLayout::Glyph& glyph = glyphs[next + i];
+
+				Vertex& quad = s_Data->QuadBufferPtr[i];
+				quad = shared;
+				quad.a_Position = transform * Vector4(glyph.Center, 0.0f, 1.0f);
+				PackHalf4(quad.a_Transform, Vector4(axisX * glyph.Size.x, axisY * glyph.Size.y));
+				PackUnorm4(quad.a_TexRect, glyph.TexRect);
 			}
+
+			s_Data->QuadBufferPtr += count;
+			s_Data->QuadCount += (uint32_t)count;
+			s_Data->Statistics.QuadCount += (uint32_t)count;
+
+			next += count;
 		}
+	}
 
-		auto mat = s_Data->ViewProjectionMatrix * transform;
+	////////////////////////////////////////////////////////
+	/// Lines //////////////////////////////////////////////
+	////////////////////////////////////////////////////////
 
-		s_Data->QuadBufferPtr->a_Position0 = Vector3(mat * Vector4(-0.5, -0.5, 0.0, 1.0));
-		s_Data->QuadBufferPtr->a_Position1 = Vector3(mat * Vector4( 0.5, -0.5, 0.0, 1.0));
-		s_Data->QuadBufferPtr->a_Position2 = Vector3(mat * Vector4(-0.5,  0.5, 0.0, 1.0));
-		s_Data->QuadBufferPtr->a_Position3 = Vector3(mat * Vector4( 0.5,  0.5, 0.0, 1.0));
+	void Renderer2D::DrawLine(const Vector2& p0, const Vector2& p1, const Color& color)
+	{
+		DrawLine(Vector3(p0, 0.0f), Vector3(p1, 0.0f), color);
+	}
 
-		s_Data->QuadBufferPtr->a_Color = props.Tint;
-		s_Data->QuadBufferPtr->a_TexCoord = (props.Sprite->GetType() == TextureType::Master) ? Vector4(0, 0, 1, 1) : std::dynamic_pointer_cast<SubTexture2D>(props.Sprite)->GetRect();
-		s_Data->QuadBufferPtr->a_TexRepeat = props.ForceTile;
+	void Renderer2D::DrawLine(const Vector3& p0, const Vector3& p1, const Color& color)
+	{
+		if (RenderThread::IsRecording())
+		{
+			Record([p0, p1, color]() { DrawLine(p0, p1, color); });
+			return;
+		}
 
-		if (props.ForceTile)
+		Vector3 points[2] = { p0, p1 };
+		DrawLineStrip(points, 2, color, false);
+	}
+
+	void Renderer2D::DrawRect(const Vector3& position, float rotation, const Vector2& size, const Color& color)
+	{
+		if (RenderThread::IsRecording())
+		{
+			Record([position, rotation, size, color]() { DrawRect(position, rotation, size, color); });
+			return;
+		}
+
+		Vector4 transform = QuadTransform(rotation, size);
+		Vector3 axisX = Vector3(transform.x, transform.y, 0.0f) * 0.5f;
+		Vector3 axisY = Vector3(transform.z, transform.w, 0.0f) * 0.5f;
+
+		Vector3 corners[4] = {
+			position - axisX - axisY,
+			position + axisX - axisY,
+			position + axisX + axisY,
+			position - axisX + axisY
+		};
+
+		DrawLineStrip(corners, 4, color, true);
+	}
+
+	void Renderer2D::DrawRect(const Mat4x4& transform, const Color& color)
+	{
+		static const Vector2 corners[4] = { { -0.5f, -0.5f }, { 0.5f, -0.5f }, { 0.5f, 0.5f }, { -0.5f, 0.5f } };
+		DrawPolygon(transform, { corners, 4 }, color, true);
+	}
+
+	void Renderer2D::DrawPolygon(const Mat4x4& transform, Span<const Vector2> points, const Color& color, bool closed)
+	{
+		if (points.size() < 2 || color.a == 0)
+			return;
+
+		if (RenderThread::IsRecording())
 		{
-			s_Data->QuadBufferPtr->a_TexRegion = s_Data->QuadBufferPtr->a_TexCoord;
+			Record([transform, points = Vector<Vector2>(points.begin(), points.end()), color, closed]() { DrawPolygon(transform, points, color, closed); });
+			return;
+		}
 
-			s_Data->QuadBufferPtr->a_TexRegion.x += (props.Flip & TextureFlip_X) * s_Data->QuadBufferPtr->a_TexRegion.z;
-			s_Data->QuadBufferPtr->a_TexRegion.z *= -1 + (int)(!(props.Flip & TextureFlip_X)) * 2;
+		// Transformed in chunks so long outlines don't need a heap allocation
+		constexpr size_t ChunkSize = 64;
+		Vector3 transformed[ChunkSize + 1];
 
-			s_Data->QuadBufferPtr->a_TexRegion.y += (props.Flip & TextureFlip_Y) * s_Data->QuadBufferPtr->a_TexRegion.w;
-			s_Data->QuadBufferPtr->a_TexRegion.w *= -1 + (int)(!(props.Flip & TextureFlip_Y)) * 2;
+		for (size_t start = 0; start < points.size(); start += ChunkSize)
+		{
+			size_t count = std::min(points.size() - start, ChunkSize);
+			for (size_t i = 0; i < count; i++)
+				transformed[i] = transform * Vector4(points[start + i], 0.0f, 1.0f);
+
+			// Connect to the next chunk's first point, or close the outline
+			bool last = start + count == points.size();
+			if (!last)
+				transformed[count++] = transform * Vector4(points[start + ChunkSize], 0.0f, 1.0f);
+			else if (closed && start > 0)
+				transformed[count++] = transform * Vector4(points[0], 0.0f, 1.0f);
+
+			DrawLineStrip(transformed, (uint32_t)count, color, last && closed && start == 0);
 		}
-		
-		s_Data->QuadBufferPtr->a_TexCoord.x *= props.Tiling.x;
-		s_Data->QuadBufferPtr->a_TexCoord.y *= props.Tiling.y;
-		s_Data->QuadBufferPtr->a_TexCoord.z *= props.Tiling.x;
-		s_Data->QuadBufferPtr->a_TexCoord.w *= props.Tiling.y;
+	}
 
-		s_Data->QuadBufferPtr->a_TexCoord.x += props.Offset.x;
-		s_Data->QuadBufferPtr->a_TexCoord.y += props.Offset.y;
+	void Renderer2D::DrawLineStrip(const Vector3* points, uint32_t count, const Color& color, bool closed)
+	{
+		if (color.a == 0)
+			return;
 
-		s_Data->QuadBufferPtr->a_TexCoord.x += (props.Flip & TextureFlip_X) * s_Data->QuadBufferPtr->a_TexCoord.z;
-		s_Data->QuadBufferPtr->a_TexCoord.z *= -1 + (int)(!(props.Flip & TextureFlip_X)) * 2;
+		uint32_t packedColor = glm::packUnorm4x8(color);
+		uint32_t lineCount = closed ? count : count - 1;
 
-		s_Data->QuadBufferPtr->a_TexCoord.y += (props.Flip & TextureFlip_X) * s_Data->QuadBufferPtr->a_TexCoord.w;
-		s_Data->QuadBufferPtr->a_TexCoord.w *= -1 + (int)(!(props.Flip & TextureFlip_Y)) * 2;
+		for (uint32_t i = 0; i < lineCount; i++)
+		{
+			LineVertex* vertices = AllocatePrimitives(s_Data->Lines, 2, FlushLines);
+			vertices[0] = { points[i], packedColor };
+			vertices[1] = { points[(i + 1) % count], packedColor };
+		}
 
-		s_Data->QuadBufferPtr++;
-		s_Data->QuadCount++;
-		s_Statistics.QuadCount++;
+		s_Data->Statistics.LineCount += lineCount;
+	}
+
+	////////////////////////////////////////////////////////
+	/// Circles ////////////////////////////////////////////
+	////////////////////////////////////////////////////////
+
+	void Renderer2D::DrawCircle(const Vector3& position, float radius, const Color& color, float thickness)
+	{
+		DrawCircleImpl(Vector4(2.0f * radius, 0.0f, 0.0f, 2.0f * radius), position, color, thickness);
+	}
+
+	void Renderer2D::DrawCircle(const Mat4x4& transform, const Color& color, float thickness)
+	{
+		DrawCircleImpl(QuadTransform(transform), transform[3], color, thickness);
+	}
+
+	void Renderer2D::DrawCircleImpl(const Vector4& transform, const Vector3& position, const Color& color, float thickness)
+	{
+		if (color.a == 0 || thickness <= 0.0f)
+			return;
+
+		if (RenderThread::IsRecording())
+		{
+			Record([transform, position, color, thickness]() { DrawCircleImpl(transform, position, color, thickness); });
+			return;
+		}
+
+		CircleInstance* circle = AllocatePrimitives(s_Data->Circles, 1, FlushCircles);
+		circle->a_Position = position;
+		PackHalf4(circle->a_Transform, transform);
+		circle->a_Color = glm::packUnorm4x8(color);
+		circle->a_Thickness = std::min(thickness, 1.0f);
+
+		s_Data->Statistics.CircleCount++;
+	}
+
+	////////////////////////////////////////////////////////
+	/// SubmissionContext //////////////////////////////////
+	////////////////////////////////////////////////////////
+
+	struct Renderer2D::SubmissionContext::Quad
+	{
+		// Texture slot and layer bits are not set yet
+		Vertex Data;
+
+		// Index into m_Textures or NoTexture
+		uint32_t Texture;
+
+		static constexpr uint32_t NoTexture = UINT32_MAX;
+	};
+
+	Renderer2D::SubmissionContext::SubmissionContext() = default;
+	Renderer2D::SubmissionContext::~SubmissionContext() = default;
+
+	Renderer2D::SubmissionContext::SubmissionContext(SubmissionContext&& other) noexcept = default;
+	Renderer2D::SubmissionContext& Renderer2D::SubmissionContext::operator=(SubmissionContext&& other) noexcept = default;
+
+	void Renderer2D::SubmissionContext::Clear()
+	{
+		m_Quads.clear();
+		m_Textures.clear();
+		m_TextureIndices.clear();
+		m_LastTexture = nullptr;
+	}
+
+	void Renderer2D::SubmissionContext::Append(const SubmissionContext& other)
+	{
+		m_Quads.reserve(m_Quads.size() + other.m_Quads.size());
+		for (const Quad& quad : other.m_Quads)
+		{
+			Quad& copy = m_Quads.emplace_back(quad);
+			if (quad.Texture != Quad::NoTexture)
+				copy.Texture = AddTexture(other.m_Textures[quad.Texture]);
+		}
+	}
+
+	uint32_t Renderer2D::SubmissionContext::GetQuadCount() const
+	{
+		return (uint32_t)m_Quads.size();
+	}
+
+	void Renderer2D::SubmissionContext::DrawQuad(const Vector3& position, float rotation, const Vector2& size, const Color& color)
+	{
+		DrawQuadImpl(QuadTransform(rotation, size), position, color);
+	}
+
+	void Renderer2D::SubmissionContext::DrawQuad(const Mat4x4& transform, const Color& color)
+	{
+		DrawQuadImpl(QuadTransform(transform), Vector3(transform[3]), color);
+	}
+
+	void Renderer2D::SubmissionContext::DrawQuad(const Vector3& position, float rotation, const Vector2& size, const TexturedQuadProps& props)
+	{
+		DrawQuadImpl(QuadTransform(rotation, size), position, props);
+	}
+
+	void Renderer2D::SubmissionContext::DrawQuad(const Mat4x4& transform, const TexturedQuadProps& props)
+	{
+		DrawQuadImpl(QuadTransform(transform), Vector3(transform[3]), props);
+	}
+
+	void Renderer2D::SubmissionContext::DrawQuadImpl(const Vector4& transform, const Vector3& position, const Color& color)
+	{
+		if (color.a == 0)
+			return;
+
+		Quad& quad = m_Quads.emplace_back();
+		PackQuad(quad.Data, transform, position, color);
+		quad.Texture = Quad::NoTexture;
+	}
+
+	void Renderer2D::SubmissionContext::DrawQuadImpl(const Vector4& transform, const Vector3& position, const TexturedQuadProps& props)
+	{
+		if (!props.Sprite)
+			return;
+
+		if (props.Tint.a == 0)
+			return;
+
+		Quad& quad = m_Quads.emplace_back();
+		const Ref<Texture2D>& texture = PackQuad(quad.Data, transform, position, props);
+		quad.Texture = AddTexture(texture);
+	}
+
+	void Renderer2D::SubmissionContext::DrawQuads(Span<const QuadInstance> instances, const TexturedQuadProps& props)
+	{
+		if (instances.empty() || props.Tint.a == 0)
+			return;
+
+		SharedQuadData shared = PackSharedQuadData(props);
+		uint32_t texture = shared.Texture ? AddTexture(*shared.Texture) : Quad::NoTexture;
+
+		m_Quads.reserve(m_Quads.size() + instances.size());
+		for (const QuadInstance& instance : instances)
+		{
+			Quad quad;
+			quad.Data = shared.Template;
+			if (!PackQuadInstance(quad.Data, instance, shared, props.Tint))
+				continue;
+
+			quad.Texture = texture;
+			m_Quads.push_back(quad);
+		}
+	}
+
+	void Renderer2D::SubmissionContext::DrawQuad(const Mat4x4& transform, const SpriteQuadProps& props)
+	{
+		// Only reads the registry, so it's safe from worker threads while nothing registers
+		const TextureRegistry::Entry* entry = TextureRegistry::Get(props.Sprite);
+		if (!entry || !entry->Master)
+		{
+			DrawQuad(transform, props.Tint);
+			return;
+		}
+
+		if (props.Tint.a == 0)
+			return;
+
+		Quad& quad = m_Quads.emplace_back();
+		const Ref<Texture2D>& texture = PackQuad(quad.Data, QuadTransform(transform), Vector3(transform[3]), props, *entry);
+		quad.Texture = AddTexture(texture);
+	}
+
+	uint32_t Renderer2D::SubmissionContext::AddTexture(const Ref<Texture2D>& texture)
+	{
+		// Runs of the same texture don't touch the map (nor the reference count)
+		if (texture.get() != m_LastTexture)
+		{
+			auto [it, inserted] = m_TextureIndices.try_emplace(texture.get(), (uint32_t)m_Textures.size());
+			if (inserted)
+				m_Textures.push_back(texture);
+
+			m_LastTexture = texture.get();
+			m_LastTextureIndex = it->second;
+		}
+
+		return m_LastTextureIndex;
+	}
+
+	void Renderer2D::Submit(const SubmissionContext& context)
+	{
+		if (RenderThread::IsRecording())
+		{
+			s_RecordedQuads->Append(context);
+			return;
+		}
+
+		for (const auto& quad : context.m_Quads)
+		{
+			if (s_Data->QuadCount >= s_Data->QuadCapacity)
+				NextBatch(BatchBreakReason::BufferFull);
+
+			Vertex data = quad.Data;
+			if (quad.Texture != SubmissionContext::Quad::NoTexture)
+				data.a_TexFlags |= ResolveTexture(context.m_Textures[quad.Texture]);
+
+			*s_Data->QuadBufferPtr = data;
+
+			s_Data->QuadBufferPtr++;
+			s_Data->QuadCount++;
+		}
+
+		s_Data->Statistics.QuadCount += context.GetQuadCount();
+	}
+
+	////////////////////////////////////////////////////////
+	/// StaticBatch ////////////////////////////////////////
+	////////////////////////////////////////////////////////
+
+	struct Renderer2D::StaticBatch::Chunk
+	{
+		Ref<VertexArray> Vertices;
+		Ref<VertexBuffer> Buffer;
+		uint32_t QuadCount;
+		uint32_t OpaqueCount; // Opaque quads come first
+
+		Vector<Ref<Texture2D>> Textures;
+	};
+
+	Renderer2D::StaticBatch::StaticBatch() = default;
+	Renderer2D::StaticBatch::~StaticBatch() = default;
+
+	Renderer2D::StaticBatch::StaticBatch(StaticBatch&& other) noexcept = default;
+	Renderer2D::StaticBatch& Renderer2D::StaticBatch::operator=(StaticBatch&& other) noexcept = default;
+
+	void Renderer2D::StaticBatch::Build(const SubmissionContext& context)
+	{
+		OE_PROFILE_FUNCTION();
+
+		Clear();
+
+		m_QuadCount = context.GetQuadCount();
+		if (m_QuadCount == 0)
+			return;
+
+		m_Chunks = CreateRef<Vector<Chunk>>();
+
+		if (RenderThread::IsRecording())
+		{
+			// Chunks are uploaded on the render thread, from a copy since `context` may change before that
+			SubmissionContext copy;
+			copy.Append(context);
+			Record([chunks = m_Chunks, context = std::move(copy)]() { BuildChunks(*chunks, context); });
+			return;
+		}
+
+		BuildChunks(*m_Chunks, context);
+	}
+
+	void Renderer2D::StaticBatch::BuildChunks(Vector<Chunk>& chunks, const SubmissionContext& context)
+	{
+		uint32_t quadCount = context.GetQuadCount();
+
+		// Same order as a depth sorted scene, opaque quads front to back then the rest back to front.
+		// Building is rare so a comparison sort is fine.
+		Vector<std::pair<uint64_t, uint32_t>> order(quadCount);
+		for (uint32_t i = 0; i < quadCount; i++)
+		{
+			const Vertex& quad = context.m_Quads[i].Data;
+			uint32_t key = DepthSortKey(quad.a_Position.z);
+
+			if (quad.a_TexFlags & QuadFlags_Opaque)
+				order[i] = { ~key, i };
+			else
+				order[i] = { (1ull << 32) | key, i };
+		}
+
+		std::stable_sort(order.begin(), order.end(), [](const auto& a, const auto& b) {
+			return a.first < b.first;
+		});
+
+		// Context texture index -> slot in the current chunk
+		static constexpr uint32_t NoSlot = UINT32_MAX;
+		Vector<uint32_t> slots(context.m_Textures.size(), NoSlot);
+
+		Vector<Vertex> vertices;
+		vertices.reserve(std::min(quadCount, MaxQuadCount));
+
+		Chunk chunk;
+		chunk.OpaqueCount = 0;
+		auto finishChunk = [&]()
+		{
+			chunk.QuadCount = (uint32_t)vertices.size();
+			uint32_t dataSize = chunk.QuadCount * (uint32_t)sizeof(Vertex);
+			chunk.Buffer = VertexBuffer::Create(vertices.data(), dataSize);
+			s_Data->Statistics.BytesUploaded += dataSize;
+			chunk.Buffer->SetLayout(GetQuadLayout(s_Data->RenderPath));
+			chunk.Vertices = VertexArray::Create();
+			chunk.Vertices->AddVertexBuffer(chunk.Buffer);
+
+			chunks.push_back(std::move(chunk));
+
+			chunk = Chunk();
+			chunk.OpaqueCount = 0;
+			vertices.clear();
+			std::fill(slots.begin(), slots.end(), NoSlot);
+		};
+
+		for (const auto& [key, index] : order)
+		{
+			const auto& quad = context.m_Quads[index];
+
+			bool newTexture = quad.Texture != SubmissionContext::Quad::NoTexture && slots[quad.Texture] == NoSlot;
+			if (vertices.size() == MaxQuadCount || (newTexture && chunk.Textures.size() == s_Data->TextureSlotCount))
+				finishChunk();
+
+			Vertex vertex = quad.Data;
+			if (quad.Texture != SubmissionContext::Quad::NoTexture)
+			{
+				uint32_t& slot = slots[quad.Texture];
+				if (slot == NoSlot)
+				{
+					slot = (uint32_t)chunk.Textures.size();
+					chunk.Textures.push_back(context.m_Textures[quad.Texture]);
+				}
+
+				vertex.a_TexFlags |= slot;
+			}
+
+			if (vertex.a_TexFlags & QuadFlags_Opaque)
+				chunk.OpaqueCount++;
+
+			vertices.push_back(vertex);
+		}
+
+		finishChunk();
+	}
+
+	void Renderer2D::StaticBatch::Clear()
+	{
+		m_Chunks = nullptr;
+		m_QuadCount = 0;
+	}
+
+	uint32_t Renderer2D::StaticBatch::GetChunkCount() const
+	{
+		// Not known before the render thread built them
+		return m_Chunks ? (uint32_t)m_Chunks->size() : 0;
+	}
+
+	void Renderer2D::DrawStaticBatch(const StaticBatch& batch, StaticBatchPart part)
+	{
+		if (!batch.m_Chunks)
+			return;
+
+		if (RenderThread::IsRecording())
+		{
+			Record([chunks = batch.m_Chunks, part]()
+			{
+				StaticBatch replay;
+				replay.m_Chunks = chunks;
+				DrawStaticBatch(replay, part);
+			});
+			return;
+		}
+
+		if (batch.m_Chunks->empty())
+			return;
+
+		// Draw what's submitted before the batch first
+		if (s_Data->QuadCount > 0)
+			NextBatch();
+
+		s_Data->Shader->Bind();
+		s_Data->Shader->UploadUniformMat4("u_ViewProjMatrix", s_Data->ViewProjectionMatrix);
+
+		bool drawOpaque = part != StaticBatchPart::Transparent;
+		bool drawTransparent = part != StaticBatchPart::Opaque;
+
+		for (const auto& chunk : *batch.m_Chunks)
+		{
+			uint32_t opaqueCount = drawOpaque ? chunk.OpaqueCount : 0;
+			uint32_t transparentCount = drawTransparent ? chunk.QuadCount - chunk.OpaqueCount : 0;
+			if (opaqueCount + transparentCount == 0)
+				continue;
+
+			for (uint32_t i = 0; i < (uint32_t)chunk.Textures.size(); i++)
+				chunk.Textures[i]->Bind(i);
+
+			chunk.Vertices->Bind();
+
+			uint32_t drawCalls = s_Data->Statistics.DrawCalls;
+			BeginBatch();
+
+			if (opaqueCount > 0)
+			{
+				RenderCommand::DisableBlending();
+				DrawQuadRange(chunk.Vertices, 0, opaqueCount);
+				RenderCommand::EnableBlending();
+			}
+
+			if (transparentCount > 0)
+			{
+				if (part == StaticBatchPart::Transparent)
+					RenderCommand::DisableDepthWriting();
+
+				DrawQuadRange(chunk.Vertices, chunk.OpaqueCount, transparentCount);
+
+				if (part == StaticBatchPart::Transparent)
+					RenderCommand::EnableDepthWriting();
+			}
+
+			EndBatch(BatchBreakReason::StaticBatch, BatchPrimitive::Quads, opaqueCount + transparentCount, s_Data->Statistics.DrawCalls - drawCalls);
+			s_Data->Statistics.QuadCount += opaqueCount + transparentCount;
+		}
 	}
 }
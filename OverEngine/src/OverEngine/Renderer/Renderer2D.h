@@ -5,6 +5,15 @@
 #include "OverEngine/Renderer/Shader.h"
 #include "OverEngine/Renderer/Camera.h"
 #include "OverEngine/Renderer/Texture.h"
+#include "OverEngine/Renderer/TextureRegistry.h"
+#include "OverEngine/Renderer/Font.h"
+
+#include <array>
+
+// Windows.h defines DrawText as DrawTextA or DrawTextW
+#ifdef DrawText
+	#undef DrawText
+#endif
 
 namespace OverEngine
 {
@@ -21,20 +30,100 @@ namespace OverEngine
 		bool ForceTile = false;
 	};
 
+	// TexturedQuadProps for hot paths, the sprite is resolved through the TextureRegistry
+	// so copying and drawing it does no reference counting or virtual calls
+	struct SpriteQuadProps
+	{
+		Color Tint = Color(1.0f);
+		TextureHandle Sprite;
+
+		Vector2 Tiling = Vector2(1.0f);
+		Vector2 Offset = Vector2(0.0f);
+		TextureFlip Flip = TextureFlip_None;
+
+		bool ForceTile = false;
+
+		// Part of the sprite to draw, normalized inside it
+		Rect TexRect = Rect(0.0f, 0.0f, 1.0f, 1.0f);
+	};
+
+	// Per quad data of Renderer2D::DrawQuads
+	struct QuadInstance
+	{
+		Vector3 Position = Vector3(0.0f);
+		float Rotation = 0.0f;
+		Vector2 Size = Vector2(1.0f);
+
+		// Multiplied by the shared tint
+		Color Tint = Color(1.0f);
+
+		// Part of the sprite to draw, normalized inside it. Useful for tiles and animation frames.
+		Rect TexRect = Rect(0.0f, 0.0f, 1.0f, 1.0f);
+	};
+
+	enum class QuadRenderPath
+	{
+		// One point per quad, expanded by a geometry shader
+		GeometryShader,
+
+		// One instance per quad, a 4 vertex triangle strip per instance
+		Instanced
+	};
+
+	// Why a batch was drawn, see Renderer2D::Statistics
+	enum class BatchBreakReason : uint8_t
+	{
+		EndScene = 0,
+		TextureSlotsFull,
+		BufferFull,
+
+		// NextBatch or Flush called from outside, or pending quads drawn before a StaticBatch
+		Explicit,
+
+		// A chunk of a StaticBatch, they're always drawn on their own
+		StaticBatch,
+
+		Count
+	};
+
+	// Quads of a StaticBatch to draw, see Renderer2D::DrawStaticBatch
+	enum class StaticBatchPart : uint8_t
+	{
+		All = 0,
+		Opaque,
+
+		// Blended without writing depth, so they don't hide what's drawn behind them afterwards
+		Transparent
+	};
+
+	// What a batch drew, quads, lines and circles each have their own buffer and shader
+	enum class BatchPrimitive : uint8_t
+	{
+		Quads = 0,
+		Lines,
+		Circles
+	};
+
 	class Renderer2D
 	{
 	public:
-		static void Init();
+		static void Init(QuadRenderPath path = QuadRenderPath::Instanced);
 		static void Shutdown();
 
+		// Called once per frame by Renderer::EndFrame
+		static void EndFrame();
+
 		static void Reset();
 
 		static void BeginScene(const Mat4x4& viewMatrix, const Camera& camera, bool depthSorting = true);
 		static void EndScene();
 
+		// Quad batches only, pending lines and circles keep batching across them
 		static void StartBatch();
-		static void NextBatch();
-		static void Flush();
+		static void NextBatch(BatchBreakReason reason = BatchBreakReason::Explicit);
+
+		// Draws everything pending: quads, then circles, then lines
+		static void Flush(BatchBreakReason reason = BatchBreakReason::Explicit);
 
 		static void DrawQuad(const Vector2& position, float rotation, const Vector2& size, const Color& color);
 		static void DrawQuad(const Vector3& position, float rotation, const Vector2& size, const Color& color);
@@ -44,24 +133,198 @@ namespace OverEngine
 		static void DrawQuad(const Vector3& position, float rotation, const Vector2& size, const TexturedQuadProps& props = TexturedQuadProps());
 		static void DrawQuad(const Mat4x4& transform, const TexturedQuadProps& props = TexturedQuadProps());
 
+		// Quads with a null or dropped handle are drawn flat colored
+		static void DrawQuad(const Mat4x4& transform, const SpriteQuadProps& props);
+
+		// Draws all the `instances` with the texture and settings of `props` (Sprite may be null for flat colored quads).
+		// The texture is resolved and the buffer space is checked once per batch instead of once per quad.
+		static void DrawQuads(Span<const QuadInstance> instances, const TexturedQuadProps& props = TexturedQuadProps());
+
+		// One unit of `transform` is one em. A null font draws with Font::GetDefault().
+		// The layout is cached by TextLayout::Get, so drawing the same text every frame is cheap.
+		static void DrawText(const Mat4x4& transform, const String& text, const Ref<Font>& font = nullptr,
+			const Color& color = Color(1.0f), TextAlignment alignment = TextAlignment::Left);
+		static void DrawText(const Mat4x4& transform, const Ref<TextLayout>& layout, const Color& color = Color(1.0f));
+
+		// One pixel wide lines, batched apart from the quads and never depth sorted.
+		// Thick lines are better drawn as rotated quads.
+		static void DrawLine(const Vector2& p0, const Vector2& p1, const Color& color);
+		static void DrawLine(const Vector3& p0, const Vector3& p1, const Color& color);
+
+		// Outline of a quad with the same parameters
+		static void DrawRect(const Vector3& position, float rotation, const Vector2& size, const Color& color);
+		static void DrawRect(const Mat4x4& transform, const Color& color);
+
+		// Outline through `points`, transformed by `transform`
+		static void DrawPolygon(const Mat4x4& transform, Span<const Vector2> points, const Color& color, bool closed = true);
+
+		// Antialiased in the fragment shader. `thickness` is the ring's width relative to
+		// the radius, 1 fills the circle. The Mat4x4 overload fills the same area as a quad.
+		static void DrawCircle(const Vector3& position, float radius, const Color& color, float thickness = 1.0f);
+		static void DrawCircle(const Mat4x4& transform, const Color& color, float thickness = 1.0f);
+
+		/**
+		 * Records quads without touching the renderer state, so one context per thread
+		 * can be filled in parallel. Texture slots are assigned when the context is passed
+		 * to Submit on the render thread, submitting contexts in a fixed order gives the
+		 * same batches as drawing the quads directly in that order.
+		 */
+		class SubmissionContext
+		{
+		public:
+			SubmissionContext();
+			~SubmissionContext();
+
+			SubmissionContext(SubmissionContext&& other) noexcept;
+			SubmissionContext& operator=(SubmissionContext&& other) noexcept;
+
+			// Keeps the allocated memory
+			void Clear();
+
+			// Appends a copy of the quads of `other`
+			void Append(const SubmissionContext& other);
+
+			void DrawQuad(const Vector3& position, float rotation, const Vector2& size, const Color& color);
+			void DrawQuad(const Mat4x4& transform, const Color& color);
+
+			void DrawQuad(const Vector3& position, float rotation, const Vector2& size, const TexturedQuadProps& props);
+			void DrawQuad(const Mat4x4& transform, const TexturedQuadProps& props);
+
+			void DrawQuad(const Mat4x4& transform, const SpriteQuadProps& props);
+
+			// Same as Renderer2D::DrawQuads
+			void DrawQuads(Span<const QuadInstance> instances, const TexturedQuadProps& props = TexturedQuadProps());
+
+			uint32_t GetQuadCount() const;
+		private:
+			void DrawQuadImpl(const Vector4& transform, const Vector3& position, const Color& color);
+			void DrawQuadImpl(const Vector4& transform, const Vector3& position, const TexturedQuadProps& props);
+
+			uint32_t AddTexture(const Ref<Texture2D>& texture);
+		private:
+			struct Quad;
+			Vector<Quad> m_Quads;
+
+			// Textures used by m_Quads, resolved to batch slots by Submit
+			Vector<Ref<Texture2D>> m_Textures;
+			UnorderedMap<const Texture2D*, uint32_t> m_TextureIndices;
+			const Texture2D* m_LastTexture = nullptr;
+			uint32_t m_LastTextureIndex = 0;
+
+			friend class Renderer2D;
+		};
+
+		// Appends the quads of `context` to the current scene
+		static void Submit(const SubmissionContext& context);
+
+		/**
+		 * Quads uploaded once into their own vertex buffers, for geometry which doesn't
+		 * change between frames. Drawing one costs a draw call per chunk and no CPU work per quad.
+		 */
+		class StaticBatch
+		{
+		public:
+			StaticBatch();
+			~StaticBatch();
+
+			StaticBatch(StaticBatch&& other) noexcept;
+			StaticBatch& operator=(StaticBatch&& other) noexcept;
+
+			// Bakes the quads of `context` sorted back to front, split into chunks
+			// whenever they run out of texture slots. Texture2DArrays are not used.
+			void Build(const SubmissionContext& context);
+			void Clear();
+
+			inline uint32_t GetQuadCount() const { return m_QuadCount; }
+			uint32_t GetChunkCount() const;
+		private:
+			struct Chunk;
+			static void BuildChunks(Vector<Chunk>& chunks, const SubmissionContext& context);
+
+			// Shared with the render thread commands using them, null when empty
+			Ref<Vector<Chunk>> m_Chunks;
+			uint32_t m_QuadCount = 0;
+
+			friend class Renderer2D;
+		};
+
+		// Draws `batch`, its quads are depth tested against the other quads but not sorted with them.
+		// Draw the opaque part before the other quads and the transparent part after them
+		// so translucent texels don't cut holes into what's behind.
+		static void DrawStaticBatch(const StaticBatch& batch, StaticBatchPart part = StaticBatchPart::All);
+
+		struct BatchStatistics
+		{
+			BatchBreakReason Reason;
+			BatchPrimitive Primitive;
+
+			// Quads, lines or circles
+			uint32_t Count;
+			uint32_t DrawCalls;
+
+			// Milliseconds, negative if the timer query wasn't ready when read back
+			float GPUTime;
+		};
+
+		// Counters of a whole frame (every scene drawn between two EndFrames)
 		struct Statistics
 		{
 			void Reset()
 			{
 				QuadCount = 0;
+				LineCount = 0;
+				CircleCount = 0;
 				DrawCalls = 0;
-			}
+				VertexCount = 0;
+				BytesUploaded = 0;
+				BatchBreaks.fill(0);
 
-			uint32_t GetIndexCount() { return QuadCount; }
-			uint32_t GetVertexCount() { return QuadCount; }
+				SubmitTime = 0.0f;
+				SortTime = 0.0f;
+				GPUTime = 0.0f;
+
+				Batches.clear();
+			}
 
 			uint32_t QuadCount;
+			uint32_t LineCount;
+			uint32_t CircleCount;
 			uint32_t DrawCalls;
+
+			// Vertices fed to the GPU, quads and circles are expanded in the shaders and nothing is indexed
+			uint32_t VertexCount;
+
+			// Quad, line and circle data written to vertex buffers
+			uint64_t BytesUploaded;
+
+			// Batch count per BatchBreakReason
+			std::array<uint32_t, (size_t)BatchBreakReason::Count> BatchBreaks;
+
+			// CPU milliseconds between BeginScene and EndScene, SortTime is a part of it
+			float SubmitTime;
+			float SortTime;
+
+			// Sum of the Batches which have a GPUTime
+			float GPUTime;
+
+			Vector<BatchStatistics> Batches;
 		};
 
-		static Statistics& GetStatistics() { return s_Statistics; }
+		// Statistics of the latest frame whose GPU timings are read back, lags a few frames behind.
+		// Returned by copy since the render thread may be updating them.
+		static Statistics GetStatistics();
+		static const char* GetBatchBreakReasonName(BatchBreakReason reason);
+		static const char* GetBatchPrimitiveName(BatchPrimitive primitive);
+
 		static Ref<Shader>& GetShader();
+		static QuadRenderPath GetQuadRenderPath();
 	private:
-		static Statistics s_Statistics;
+		static void FlushQuads(BatchBreakReason reason);
+
+		static void DrawQuadImpl(const Vector4& transform, const Vector3& position, const Color& color);
+		static void DrawQuadImpl(const Vector4& transform, const Vector3& position, const TexturedQuadProps& props);
+
+		static void DrawLineStrip(const Vector3* points, uint32_t count, const Color& color, bool closed);
+		static void DrawCircleImpl(const Vector4& transform, const Vector3& position, const Color& color, float thickness);
 	};
 }
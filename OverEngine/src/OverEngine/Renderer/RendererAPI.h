@@ -7,7 +7,17 @@ namespace OverEngine
 {
 	enum class DrawType
 	{
-		None = 0, Points, Lines, Triangles
+		None = 0, Points, Lines, Triangles, TriangleStrip
+	};
+
+	using BarrierFlags = uint8_t;
+
+	// What has to see the shader storage writes made before a RenderCommand::Barrier
+	enum BarrierFlags_ : BarrierFlags
+	{
+		BarrierFlags_None = 0,
+		BarrierFlags_Storage = BIT(0), // Reads and writes from later shaders
+		BarrierFlags_Command = BIT(1)  // Arguments of RenderCommand::DrawIndirect
 	};
 
 	class RendererAPI
@@ -15,7 +25,10 @@ namespace OverEngine
 	public:
 		enum class API
 		{
-			None = 0, OpenGL = 1
+			// Headless, resources keep their metadata but nothing is drawn
+			None = 0,
+
+			OpenGL = 1
 		};
 	public:
 		virtual void Init() = 0;
@@ -26,6 +39,15 @@ namespace OverEngine
 		virtual void Clear(const ClearFlags& flags) = 0;
 
 		virtual void DrawIndexed(const Ref<VertexArray>& vertexArray, uint32_t indexCount = 0, DrawType drawType = DrawType::Triangles) = 0;
+		virtual void DrawArrays(const Ref<VertexArray>& vertexArray, uint32_t first, uint32_t count, DrawType drawType = DrawType::Triangles) = 0;
+		virtual void DrawInstanced(const Ref<VertexArray>& vertexArray, uint32_t vertexCount, uint32_t instanceCount, uint32_t baseInstance = 0, DrawType drawType = DrawType::Triangles) = 0;
+
+		// `commands` holds { vertexCount, instanceCount, firstVertex, baseInstance } as uint32s at `offset`
+		virtual void DrawIndirect(const Ref<VertexArray>& vertexArray, const Ref<StorageBuffer>& commands, uint32_t offset = 0, DrawType drawType = DrawType::Triangles) = 0;
+
+		// Runs the bound compute shader
+		virtual void DispatchCompute(uint32_t groupCountX, uint32_t groupCountY = 1, uint32_t groupCountZ = 1) = 0;
+		virtual void Barrier(BarrierFlags flags) = 0;
 
 		virtual uint32_t GetMaxTextureSize() = 0;
 		virtual uint32_t GetMaxTextureSlotCount() = 0;
@@ -34,7 +56,16 @@ namespace OverEngine
 		virtual void DisableDepthTesting() = 0;
 		virtual void EnableDepthTesting() = 0;
 
+		virtual void DisableDepthWriting() = 0;
+		virtual void EnableDepthWriting() = 0;
+
+		virtual void DisableBlending() = 0;
+		virtual void EnableBlending() = 0;
+
 		inline static API GetAPI() { return s_API; }
+
+		// Only before anything is created, Application does it from its props
+		inline static void SetAPI(API api) { s_API = api; }
 	private:
 		static API s_API;
 	};
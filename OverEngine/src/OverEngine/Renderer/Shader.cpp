@@ -4,7 +4,9 @@
 #include "OverEngine/Core/Core.h"
 
 #include "RendererAPI.h"
+#include "RenderThread.h"
 #include "Platform/OpenGL/OpenGLShader.h"
+#include "Platform/Null/NullShader.h"
 
 namespace OverEngine
 {
@@ -16,8 +18,8 @@ namespace OverEngine
 	{
 		switch (RendererAPI::GetAPI())
 		{
-		case RendererAPI::API::None:    OE_CORE_ASSERT(false, "RendererAPI::None is currently not supported!"); return nullptr;
-		case RendererAPI::API::OpenGL:  return CreateRef<OpenGLShader>(filePath);
+		case RendererAPI::API::None:    return CreateRef<NullShader>(filePath);
+		case RendererAPI::API::OpenGL:  return CreateRenderResource<OpenGLShader>(filePath);
 		}
 
 		OE_CORE_ASSERT(false, "Unknown RendererAPI!");
@@ -28,8 +30,8 @@ namespace OverEngine
 	{
 		switch (RendererAPI::GetAPI())
 		{
-		case RendererAPI::API::None:    OE_CORE_ASSERT(false, "RendererAPI::None is currently not supported!"); return nullptr;
-		case RendererAPI::API::OpenGL:  return CreateRef<OpenGLShader>(name, vertexSrc, fragmentSrc);
+		case RendererAPI::API::None:    return CreateRef<NullShader>(name, vertexSrc, fragmentSrc);
+		case RendererAPI::API::OpenGL:  return CreateRenderResource<OpenGLShader>(name, vertexSrc, fragmentSrc);
 		}
 
 		OE_CORE_ASSERT(false, "Unknown RendererAPI!");
@@ -40,8 +42,8 @@ namespace OverEngine
 	{
 		switch (RendererAPI::GetAPI())
 		{
-		case RendererAPI::API::None:    OE_CORE_ASSERT(false, "RendererAPI::None is currently not supported!"); return nullptr;
-		case RendererAPI::API::OpenGL:  return CreateRef<OpenGLShader>(name, vertexSrc, fragmentSrc);
+		case RendererAPI::API::None:    return CreateRef<NullShader>(name, vertexSrc, fragmentSrc);
+		case RendererAPI::API::OpenGL:  return CreateRenderResource<OpenGLShader>(name, vertexSrc, fragmentSrc);
 		}
 
 		OE_CORE_ASSERT(false, "Unknown RendererAPI!");
@@ -2,8 +2,10 @@
 
 #include "OverEngine/Renderer/Texture.h"
 #include "OverEngine/Renderer/RendererAPI.h"
+#include "OverEngine/Renderer/RenderThread.h"
 
 #include "Platform/OpenGL/OpenGLTexture.h"
+#include "Platform/Null/NullTexture.h"
 
 #include <stb_image.h>
 
@@ -13,8 +15,8 @@ namespace OverEngine
 	{
 		switch (RendererAPI::GetAPI())
 		{
-		case RendererAPI::API::None:    OE_CORE_ASSERT(false, "RendererAPI::None is currently not supported!"); return nullptr;
-		case RendererAPI::API::OpenGL:  return CreateRef<OpenGLTexture2D>(path);
+		case RendererAPI::API::None:    return CreateRef<NullTexture2D>(path);
+		case RendererAPI::API::OpenGL:  return CreateRenderResource<OpenGLTexture2D>(path);
 		}
 
 		OE_CORE_ASSERT(false, "Unknown RendererAPI!");
@@ -25,17 +27,41 @@ namespace OverEngine
 	{
 		switch (RendererAPI::GetAPI())
 		{
-		case RendererAPI::API::None:    OE_CORE_ASSERT(false, "RendererAPI::None is currently not supported!"); return nullptr;
-		case RendererAPI::API::OpenGL:  return CreateRef<OpenGLTexture2D>(guid);
+		case RendererAPI::API::None:    return CreateRef<NullTexture2D>(guid);
+		case RendererAPI::API::OpenGL:  return CreateRenderResource<OpenGLTexture2D>(guid);
 		}
 
 		OE_CORE_ASSERT(false, "Unknown RendererAPI!");
 		return nullptr;
 	}
 
-	Ref<Texture2D> SubTexture2D::Create(const Ref<Texture2D>& texture, const Rect& rect)
+	Ref<Texture2D> Texture2D::Create(uint32_t width, uint32_t height, TextureFormat format, const void* data)
 	{
-		return CreateRef<SubTexture2D>(texture, rect);
+		switch (RendererAPI::GetAPI())
+		{
+		case RendererAPI::API::None:    return CreateRef<NullTexture2D>(width, height, format, data);
+		case RendererAPI::API::OpenGL:  return CreateRenderResource<OpenGLTexture2D>(width, height, format, data);
+		}
+
+		OE_CORE_ASSERT(false, "Unknown RendererAPI!");
+		return nullptr;
+	}
+
+	Ref<Texture2DArray> Texture2DArray::Create(uint32_t width, uint32_t height, uint32_t layerCount, TextureFormat format)
+	{
+		switch (RendererAPI::GetAPI())
+		{
+		case RendererAPI::API::None:    return CreateRef<NullTexture2DArray>(width, height, layerCount, format);
+		case RendererAPI::API::OpenGL:  return CreateRenderResource<OpenGLTexture2DArray>(width, height, layerCount, format);
+		}
+
+		OE_CORE_ASSERT(false, "Unknown RendererAPI!");
+		return nullptr;
+	}
+
+	Ref<Texture2D> SubTexture2D::Create(const Ref<Texture2D>& texture, const Rect& rect, bool atlasRegion)
+	{
+		return CreateRef<SubTexture2D>(texture, rect, atlasRegion);
 	}
 
 	Ref<Texture2D> SubTexture2D::Create(const uint64_t& guid)
@@ -43,8 +69,8 @@ namespace OverEngine
 		return CreateRef<SubTexture2D>(guid);
 	}
 
-	SubTexture2D::SubTexture2D(const Ref<Texture2D>& texture, const Rect& rect)
-		: m_MasterTexture(texture), m_Rect(rect)
+	SubTexture2D::SubTexture2D(const Ref<Texture2D>& texture, const Rect& rect, bool atlasRegion)
+		: m_MasterTexture(texture), m_Rect(rect), m_AtlasRegion(atlasRegion)
 	{
 		m_Rect /= Rect(
 			texture->GetWidth(), texture->GetHeight(),
@@ -63,17 +89,19 @@ namespace OverEngine
 		if (auto otherSubTexture = std::dynamic_pointer_cast<SubTexture2D>(other))
 		{
 			m_MasterTexture = otherSubTexture->m_MasterTexture;
+			m_Rect = otherSubTexture->m_Rect;
+			m_AtlasRegion = otherSubTexture->m_AtlasRegion;
 		}
 	}
 
 	uint32_t SubTexture2D::GetWidth() const
 	{
-		return static_cast<uint32_t>(m_Rect.z);
+		return static_cast<uint32_t>(std::round(m_Rect.z * m_MasterTexture->GetWidth()));
 	}
 
 	uint32_t SubTexture2D::GetHeight() const
 	{
-		return static_cast<uint32_t>(m_Rect.w);
+		return static_cast<uint32_t>(std::round(m_Rect.w * m_MasterTexture->GetHeight()));
 	}
 
 	uint32_t SubTexture2D::GetRendererID() const
@@ -125,4 +153,9 @@ namespace OverEngine
 	{
 		return TextureType::SubTexture;
 	}
+
+	bool SubTexture2D::IsOpaque() const
+	{
+		return m_MasterTexture->IsOpaque();
+	}
 }
@@ -37,6 +37,14 @@ namespace OverEngine
 		// Other
 		virtual TextureFormat GetFormat() const = 0;
 		virtual TextureType GetType() const = 0;
+
+		// True if every texel has full alpha, such textures can be drawn without blending
+		virtual bool IsOpaque() const = 0;
+
+		// Bumped when the texture's pixels are replaced in place, like when its asset is reloaded
+		inline uint32_t GetGeneration() const { return m_Generation; }
+	protected:
+		uint32_t m_Generation = 0;
 	};
 
 	class Texture2D : public Texture
@@ -46,6 +54,7 @@ namespace OverEngine
 	public:
 		static Ref<Texture2D> Create(const String& path);
 		static Ref<Texture2D> Create(const uint64_t& guid);
+		static Ref<Texture2D> Create(uint32_t width, uint32_t height, TextureFormat format, const void* data = nullptr);
 	};
 
 	class SubTexture2D : public Texture2D
@@ -53,10 +62,10 @@ namespace OverEngine
 		OE_CLASS_NO_REFLECT(SubTexture2D, Texture2D)
 
 	public:
-		static Ref<Texture2D> Create(const Ref<Texture2D>& texture, const Rect& rect);
+		static Ref<Texture2D> Create(const Ref<Texture2D>& texture, const Rect& rect, bool atlasRegion = false);
 		static Ref<Texture2D> Create(const uint64_t& guid);
 
-		SubTexture2D(const Ref<Texture2D>& texture, const Rect& rect);
+		SubTexture2D(const Ref<Texture2D>& texture, const Rect& rect, bool atlasRegion = false);
 		SubTexture2D(const uint64_t& guid);
 		virtual void Acquire(Ref<Asset> other) override;
 
@@ -82,9 +91,14 @@ namespace OverEngine
 		// Other
 		virtual TextureFormat GetFormat() const override;
 		virtual TextureType GetType() const override;
+		virtual bool IsOpaque() const override;
 
 		const Rect& GetRect() const { return m_Rect; }
-		Ref<Texture2D> GetMasterTexture() const { return m_MasterTexture; }
+		const Ref<Texture2D>& GetMasterTexture() const { return m_MasterTexture; }
+
+		// Stands for a whole texture packed into an atlas page (see TextureAtlasBuilder),
+		// so tiling repeats inside the rect instead of bleeding into the neighbours.
+		bool IsAtlasRegion() const { return m_AtlasRegion; }
 
 		// Asset
 		virtual bool IsReference() const override { return m_MasterTexture == nullptr; }
@@ -92,5 +106,31 @@ namespace OverEngine
 
 		Ref<Texture2D> m_MasterTexture = nullptr;
 		Rect m_Rect;
+		bool m_AtlasRegion = false;
+	};
+
+	// A stack of same sized layers sampled through one texture slot.
+	// Not an asset, used by the renderers to group small textures.
+	class Texture2DArray
+	{
+	public:
+		static Ref<Texture2DArray> Create(uint32_t width, uint32_t height, uint32_t layerCount, TextureFormat format);
+
+		virtual ~Texture2DArray() = default;
+
+		virtual uint32_t GetWidth() const = 0;
+		virtual uint32_t GetHeight() const = 0;
+		virtual uint32_t GetLayerCount() const = 0;
+		virtual uint32_t GetRendererID() const = 0;
+		virtual TextureFormat GetFormat() const = 0;
+
+		virtual void Bind(uint32_t slot = 0) = 0;
+
+		virtual void SetFilter(TextureFilter filter) = 0;
+		virtual void SetUWrap(TextureWrap wrap) = 0;
+		virtual void SetVWrap(TextureWrap wrap) = 0;
+
+		// Copies the whole `texture` into `layer`, it must have the same size and format as the array
+		virtual void CopyToLayer(const Ref<Texture2D>& texture, uint32_t layer) = 0;
 	};
 }
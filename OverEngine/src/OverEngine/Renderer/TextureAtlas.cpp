@@ -0,0 +1,371 @@
+#include "pcheader.h"
+#include "TextureAtlas.h"
+
+#include <stb_image.h>
+#include <yaml-cpp/yaml.h>
+
+#include <filesystem>
+#include <fstream>
+
+namespace OverEngine
+{
+	////////////////////////////////////////////////////////
+	// SkylinePacker ///////////////////////////////////////
+	////////////////////////////////////////////////////////
+
+	SkylinePacker::SkylinePacker(uint32_t width, uint32_t height)
+		: m_Width(width), m_Height(height)
+	{
+		m_Skyline.push_back({ 0, 0, width });
+	}
+
+	bool SkylinePacker::Pack(uint32_t width, uint32_t height, uint32_t& x, uint32_t& y)
+	{
+		uint32_t bestIndex = UINT32_MAX;
+		uint32_t bestY = UINT32_MAX;
+		uint32_t bestSegmentWidth = UINT32_MAX;
+
+		for (uint32_t i = 0; i < (uint32_t)m_Skyline.size(); i++)
+		{
+			uint32_t fitY;
+			if (!Fits(i, width, height, fitY))
+				continue;
+
+			// Lowest placement wins, ties go to the narrowest segment to leave less holes
+			if (fitY < bestY || (fitY == bestY && m_Skyline[i].Width < bestSegmentWidth))
+			{
+				bestIndex = i;
+				bestY = fitY;
+				bestSegmentWidth = m_Skyline[i].Width;
+			}
+		}
+
+		if (bestIndex == UINT32_MAX)
+			return false;
+
+		x = m_Skyline[bestIndex].X;
+		y = bestY;
+		AddLevel(bestIndex, x, y, width, height);
+		return true;
+	}
+
+	bool SkylinePacker::Fits(uint32_t index, uint32_t width, uint32_t height, uint32_t& y) const
+	{
+		uint32_t x = m_Skyline[index].X;
+		if (x + width > m_Width)
+			return false;
+
+		// The rect rests on the highest segment below it
+		y = 0;
+		uint32_t widthLeft = width;
+		for (uint32_t i = index; widthLeft > 0; i++)
+		{
+			y = std::max(y, m_Skyline[i].Y);
+			if (y + height > m_Height)
+				return false;
+
+			widthLeft -= std::min(widthLeft, m_Skyline[i].Width);
+		}
+
+		return true;
+	}
+
+	void SkylinePacker::AddLevel(uint32_t index, uint32_t x, uint32_t y, uint32_t width, uint32_t height)
+	{
+		m_Skyline.insert(m_Skyline.begin() + index, { x, y + height, width });
+
+		// Cut the segments covered by the new one
+		for (uint32_t i = index + 1; i < (uint32_t)m_Skyline.size();)
+		{
+			Segment& previous = m_Skyline[i - 1];
+			Segment& current = m_Skyline[i];
+
+			if (current.X >= previous.X + previous.Width)
+				break;
+
+			uint32_t shrink = previous.X + previous.Width - current.X;
+			if (shrink < current.Width)
+			{
+				current.X += shrink;
+				current.Width -= shrink;
+				break;
+			}
+
+			m_Skyline.erase(m_Skyline.begin() + i);
+		}
+
+		// Merge neighbours at the same height
+		for (uint32_t i = 1; i < (uint32_t)m_Skyline.size();)
+		{
+			if (m_Skyline[i - 1].Y == m_Skyline[i].Y)
+			{
+				m_Skyline[i - 1].Width += m_Skyline[i].Width;
+				m_Skyline.erase(m_Skyline.begin() + i);
+			}
+			else
+			{
+				i++;
+			}
+		}
+	}
+
+	////////////////////////////////////////////////////////
+	// TextureAtlasBuilder /////////////////////////////////
+	////////////////////////////////////////////////////////
+
+	static int64_t GetModifiedTime(const String& path)
+	{
+		std::error_code error;
+		auto time = std::filesystem::last_write_time(path, error);
+		return error ? 0 : (int64_t)time.time_since_epoch().count();
+	}
+
+	// Paths are stored relative to the cache file, so moving the project doesn't invalidate it
+	static String GetCacheKey(const String& path, const String& cachePath)
+	{
+		auto base = std::filesystem::path(cachePath).parent_path();
+		return std::filesystem::path(path).lexically_relative(base).generic_string();
+	}
+
+	static uint32_t NextPowerOfTwo(uint32_t value)
+	{
+		uint32_t result = 1;
+		while (result < value)
+			result <<= 1;
+		return result;
+	}
+
+	TextureAtlasBuilder::TextureAtlasBuilder(const TextureAtlasProps& props)
+		: m_Props(props)
+	{
+		OE_CORE_ASSERT(m_Props.MaxTextureSize + 2 * m_Props.Padding <= m_Props.PageSize, "Atlas pages can't fit the biggest texture!");
+	}
+
+	bool TextureAtlasBuilder::Add(const String& path)
+	{
+		int width, height, channels;
+		if (!stbi_info(path.c_str(), &width, &height, &channels))
+			return false;
+
+		if ((uint32_t)width > m_Props.MaxTextureSize || (uint32_t)height > m_Props.MaxTextureSize)
+			return false;
+
+		Entry& entry = m_Entries.emplace_back();
+		entry.Path = path;
+		entry.Width = width;
+		entry.Height = height;
+		entry.ModifiedTime = GetModifiedTime(path);
+		return true;
+	}
+
+	UnorderedMap<String, Ref<Texture2D>> TextureAtlasBuilder::Build(const String& cachePath)
+	{
+		OE_PROFILE_FUNCTION();
+
+		UnorderedMap<String, Ref<Texture2D>> regions;
+
+		if (m_Entries.empty())
+			return regions;
+
+		if (cachePath.empty() || !LoadCache(cachePath))
+		{
+			Pack();
+
+			if (!cachePath.empty())
+				SaveCache(cachePath);
+		}
+
+		// Shrink each page to the used area, rounded up to keep the pages power of two
+		Vector<std::pair<uint32_t, uint32_t>> pageSizes(m_PageCount, { 1, 1 });
+		for (const auto& entry : m_Entries)
+		{
+			auto& [width, height] = pageSizes[entry.Page];
+			width = std::max(width, NextPowerOfTwo(entry.X + entry.Width + m_Props.Padding));
+			height = std::max(height, NextPowerOfTwo(entry.Y + entry.Height + m_Props.Padding));
+		}
+
+		Vector<Vector<uint8_t>> pagePixels(m_PageCount);
+		for (uint32_t i = 0; i < m_PageCount; i++)
+			pagePixels[i].resize((size_t)pageSizes[i].first * pageSizes[i].second * 4, 0);
+
+		Vector<const Entry*> loadedEntries;
+		loadedEntries.reserve(m_Entries.size());
+
+		for (const auto& entry : m_Entries)
+		{
+			int width, height, channels;
+			stbi_uc* data = stbi_load(entry.Path.c_str(), &width, &height, &channels, 4);
+
+			if (!data || (uint32_t)width != entry.Width || (uint32_t)height != entry.Height)
+			{
+				OE_CORE_WARN("Texture '{}' could not be added to the atlas! reason: '{}'", entry.Path, data ? "size changed" : stbi_failure_reason());
+
+				if (data)
+					stbi_image_free(data);
+				continue;
+			}
+
+			// Copy the image and extrude its edges into the padding
+			uint32_t pageWidth = pageSizes[entry.Page].first;
+			uint8_t* pixels = pagePixels[entry.Page].data();
+
+			int padding = (int)m_Props.Padding;
+			for (int y = -padding; y < height + padding; y++)
+			{
+				int srcY = std::clamp(y, 0, height - 1);
+				for (int x = -padding; x < width + padding; x++)
+				{
+					int srcX = std::clamp(x, 0, width - 1);
+
+					size_t dst = ((size_t)(entry.Y + y) * pageWidth + (entry.X + x)) * 4;
+					size_t src = ((size_t)srcY * width + srcX) * 4;
+					memcpy(pixels + dst, data + src, 4);
+				}
+			}
+
+			stbi_image_free(data);
+			loadedEntries.push_back(&entry);
+		}
+
+		Vector<Ref<Texture2D>> pages(m_PageCount);
+		for (uint32_t i = 0; i < m_PageCount; i++)
+			pages[i] = Texture2D::Create(pageSizes[i].first, pageSizes[i].second, TextureFormat::RGBA8, pagePixels[i].data());
+
+		for (const Entry* entry : loadedEntries)
+		{
+			Rect rect((float)entry->X, (float)entry->Y, (float)entry->Width, (float)entry->Height);
+			regions[entry->Path] = SubTexture2D::Create(pages[entry->Page], rect, true);
+		}
+
+		OE_CORE_INFO("Packed {} textures into {} atlas pages", loadedEntries.size(), m_PageCount);
+		return regions;
+	}
+
+	void TextureAtlasBuilder::Pack()
+	{
+		OE_PROFILE_FUNCTION();
+
+		// Tallest first gives the skyline the flattest top
+		Vector<Entry*> order;
+		order.reserve(m_Entries.size());
+		for (auto& entry : m_Entries)
+			order.push_back(&entry);
+
+		std::stable_sort(order.begin(), order.end(), [](const Entry* a, const Entry* b) {
+			return a->Height != b->Height ? a->Height > b->Height : a->Width > b->Width;
+		});
+
+		Vector<SkylinePacker> pages;
+		for (Entry* entry : order)
+		{
+			uint32_t width = entry->Width + 2 * m_Props.Padding;
+			uint32_t height = entry->Height + 2 * m_Props.Padding;
+
+			uint32_t x = 0, y = 0;
+			uint32_t page = 0;
+			for (; page < (uint32_t)pages.size(); page++)
+			{
+				if (pages[page].Pack(width, height, x, y))
+					break;
+			}
+
+			if (page == (uint32_t)pages.size())
+			{
+				pages.emplace_back(m_Props.PageSize, m_Props.PageSize);
+				bool packed = pages.back().Pack(width, height, x, y);
+				OE_CORE_ASSERT(packed, "Texture doesn't fit in an empty atlas page!");
+			}
+
+			entry->Page = page;
+			entry->X = x + m_Props.Padding;
+			entry->Y = y + m_Props.Padding;
+		}
+
+		m_PageCount = (uint32_t)pages.size();
+	}
+
+	bool TextureAtlasBuilder::LoadCache(const String& cachePath)
+	{
+		if (!std::filesystem::exists(cachePath))
+			return false;
+
+		try
+		{
+			YAML::Node cache = YAML::LoadFile(cachePath);
+
+			if (cache["PageSize"].as<uint32_t>() != m_Props.PageSize ||
+				cache["Padding"].as<uint32_t>() != m_Props.Padding ||
+				cache["MaxTextureSize"].as<uint32_t>() != m_Props.MaxTextureSize)
+				return false;
+
+			YAML::Node entries = cache["Entries"];
+			if (!entries || entries.size() != m_Entries.size())
+				return false;
+
+			UnorderedMap<String, YAML::Node> entryNodes;
+			for (YAML::Node entryNode : entries)
+				entryNodes[entryNode["Path"].as<String>()] = entryNode;
+
+			uint32_t pageCount = 0;
+			for (auto& entry : m_Entries)
+			{
+				auto it = entryNodes.find(GetCacheKey(entry.Path, cachePath));
+				if (it == entryNodes.end())
+					return false;
+
+				const YAML::Node& node = it->second;
+				if (node["Width"].as<uint32_t>() != entry.Width ||
+					node["Height"].as<uint32_t>() != entry.Height ||
+					node["ModifiedTime"].as<int64_t>() != entry.ModifiedTime)
+					return false;
+
+				entry.Page = node["Page"].as<uint32_t>();
+				entry.X = node["X"].as<uint32_t>();
+				entry.Y = node["Y"].as<uint32_t>();
+
+				if (entry.X + entry.Width + m_Props.Padding > m_Props.PageSize || entry.Y + entry.Height + m_Props.Padding > m_Props.PageSize)
+					return false;
+
+				pageCount = std::max(pageCount, entry.Page + 1);
+			}
+
+			m_PageCount = pageCount;
+			return true;
+		}
+		catch (const std::exception&)
+		{
+			OE_CORE_WARN("Bad texture atlas cache '{}', repacking", cachePath);
+			return false;
+		}
+	}
+
+	void TextureAtlasBuilder::SaveCache(const String& cachePath) const
+	{
+		YAML::Emitter out;
+		out << YAML::BeginMap;
+
+		out << YAML::Key << "PageSize" << YAML::Value << m_Props.PageSize;
+		out << YAML::Key << "Padding" << YAML::Value << m_Props.Padding;
+		out << YAML::Key << "MaxTextureSize" << YAML::Value << m_Props.MaxTextureSize;
+
+		out << YAML::Key << "Entries" << YAML::Value << YAML::BeginSeq;
+		for (const auto& entry : m_Entries)
+		{
+			out << YAML::Flow << YAML::BeginMap;
+			out << YAML::Key << "Path" << YAML::Value << GetCacheKey(entry.Path, cachePath);
+			out << YAML::Key << "Width" << YAML::Value << entry.Width;
+			out << YAML::Key << "Height" << YAML::Value << entry.Height;
+			out << YAML::Key << "ModifiedTime" << YAML::Value << entry.ModifiedTime;
+			out << YAML::Key << "Page" << YAML::Value << entry.Page;
+			out << YAML::Key << "X" << YAML::Value << entry.X;
+			out << YAML::Key << "Y" << YAML::Value << entry.Y;
+			out << YAML::EndMap;
+		}
+		out << YAML::EndSeq;
+
+		out << YAML::EndMap;
+
+		std::ofstream fout(cachePath);
+		fout << out.c_str();
+	}
+}
@@ -0,0 +1,85 @@
+#pragma once
+
+#include "OverEngine/Core/Core.h"
+#include "OverEngine/Renderer/Texture.h"
+
+namespace OverEngine
+{
+	// Bottom-left skyline rectangle packer.
+	// Keeps the top edge of the packed area as a list of horizontal segments and
+	// places each rect on the lowest segment it fits on.
+	class SkylinePacker
+	{
+	public:
+		SkylinePacker(uint32_t width, uint32_t height);
+
+		bool Pack(uint32_t width, uint32_t height, uint32_t& x, uint32_t& y);
+
+		inline uint32_t GetWidth() const { return m_Width; }
+		inline uint32_t GetHeight() const { return m_Height; }
+	private:
+		bool Fits(uint32_t index, uint32_t width, uint32_t height, uint32_t& y) const;
+		void AddLevel(uint32_t index, uint32_t x, uint32_t y, uint32_t width, uint32_t height);
+	private:
+		struct Segment
+		{
+			uint32_t X, Y, Width;
+		};
+
+		uint32_t m_Width, m_Height;
+		Vector<Segment> m_Skyline;
+	};
+
+	struct TextureAtlasProps
+	{
+		uint32_t PageSize = 2048;
+
+		// Border around each texture filled with its edge texels, so bilinear
+		// filtering doesn't pick up the neighbours
+		uint32_t Padding = 2;
+
+		// Textures bigger than this on any axis keep their own texture
+		uint32_t MaxTextureSize = 256;
+	};
+
+	// Packs small image files into shared RGBA8 atlas pages and hands out
+	// a SubTexture2D region for each one of them.
+	//
+	// The placements are cached on disk (see Build), so as long as the images
+	// don't change, the packer doesn't run and the pages come out identical
+	// between runs.
+	class TextureAtlasBuilder
+	{
+	public:
+		TextureAtlasBuilder(const TextureAtlasProps& props = TextureAtlasProps());
+
+		// Returns false if the image can't be read or is too big for the atlas
+		bool Add(const String& path);
+
+		// Returns the region of each added path which could be packed.
+		// `cachePath` is read to reuse the previous packing and rewritten when it's stale,
+		// pass an empty string to always pack from scratch.
+		UnorderedMap<String, Ref<Texture2D>> Build(const String& cachePath = String());
+
+		inline const TextureAtlasProps& GetProps() const { return m_Props; }
+		inline uint32_t GetPageCount() const { return m_PageCount; }
+	private:
+		struct Entry
+		{
+			String Path;
+			uint32_t Width, Height;
+			int64_t ModifiedTime;
+
+			uint32_t Page = 0;
+			uint32_t X = 0, Y = 0;
+		};
+
+		bool LoadCache(const String& cachePath);
+		void SaveCache(const String& cachePath) const;
+		void Pack();
+	private:
+		TextureAtlasProps m_Props;
+		Vector<Entry> m_Entries;
+		uint32_t m_PageCount = 0;
+	};
+}
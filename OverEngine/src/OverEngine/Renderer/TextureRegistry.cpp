@@ -0,0 +1,129 @@
+#include "pcheader.h"
+#include "TextureRegistry.h"
+
+namespace OverEngine
+{
+	struct TextureRegistrySlot
+	{
+		Ref<Texture2D> Texture;
+		TextureRegistry::Entry Data;
+		uint32_t Generation = 0;
+	};
+
+	struct TextureRegistryData
+	{
+		Vector<TextureRegistrySlot> Slots;
+		Vector<uint32_t> FreeSlots;
+		UnorderedMap<const Texture2D*, uint32_t> Indices;
+	};
+
+	static TextureRegistryData s_Registry;
+
+	static void Refresh(TextureRegistrySlot& slot)
+	{
+		auto& data = slot.Data;
+
+		if (slot.Texture->GetType() == TextureType::SubTexture)
+		{
+			const auto& subTexture = static_cast<const SubTexture2D&>(*slot.Texture);
+			data.Master = subTexture.GetMasterTexture();
+			data.TexRect = subTexture.GetRect();
+			data.AtlasRegion = subTexture.IsAtlasRegion();
+		}
+		else
+		{
+			data.Master = slot.Texture->IsReference() ? nullptr : slot.Texture;
+			data.TexRect = Rect(0.0f, 0.0f, 1.0f, 1.0f);
+			data.AtlasRegion = false;
+		}
+
+		data.Opaque = data.Master && data.Master->IsOpaque();
+	}
+
+	TextureHandle TextureRegistry::Register(const Ref<Texture2D>& texture)
+	{
+		OE_CORE_ASSERT(texture, "Registering a null texture!");
+
+		auto it = s_Registry.Indices.find(texture.get());
+		if (it != s_Registry.Indices.end())
+			return { it->second, s_Registry.Slots[it->second].Generation };
+
+		uint32_t index;
+		if (!s_Registry.FreeSlots.empty())
+		{
+			index = s_Registry.FreeSlots.back();
+			s_Registry.FreeSlots.pop_back();
+		}
+		else
+		{
+			index = (uint32_t)s_Registry.Slots.size();
+			s_Registry.Slots.emplace_back();
+		}
+
+		auto& slot = s_Registry.Slots[index];
+		slot.Texture = texture;
+		slot.Generation++;
+		Refresh(slot);
+
+		s_Registry.Indices[texture.get()] = index;
+		return { index, slot.Generation };
+	}
+
+	const TextureRegistry::Entry* TextureRegistry::Get(TextureHandle handle)
+	{
+		if (handle.Index >= s_Registry.Slots.size())
+			return nullptr;
+
+		const auto& slot = s_Registry.Slots[handle.Index];
+		if (slot.Generation != handle.Generation || !slot.Texture)
+			return nullptr;
+
+		return &slot.Data;
+	}
+
+	void TextureRegistry::Update()
+	{
+		for (uint32_t i = 0; i < (uint32_t)s_Registry.Slots.size(); i++)
+		{
+			auto& slot = s_Registry.Slots[i];
+			if (!slot.Texture)
+				continue;
+
+			// Only the registry holds it (a master texture is referenced twice by its own slot)
+			long ownReferences = slot.Data.Master == slot.Texture ? 2 : 1;
+			if (slot.Texture.use_count() == ownReferences)
+			{
+				s_Registry.Indices.erase(slot.Texture.get());
+				slot.Texture = nullptr;
+				slot.Data.Master = nullptr;
+				s_Registry.FreeSlots.push_back(i);
+				continue;
+			}
+
+			// Assets may have been reloaded in place
+			Refresh(slot);
+		}
+	}
+
+	void TextureRegistry::Clear()
+	{
+		// Generations survive, so old handles stay invalid
+		for (uint32_t i = 0; i < (uint32_t)s_Registry.Slots.size(); i++)
+		{
+			auto& slot = s_Registry.Slots[i];
+			if (!slot.Texture)
+				continue;
+
+			slot.Texture = nullptr;
+			slot.Data.Master = nullptr;
+			s_Registry.FreeSlots.push_back(i);
+		}
+
+		s_Registry.Indices.clear();
+	}
+
+	uint32_t TextureRegistry::GetTextureCount()
+	{
+		return (uint32_t)s_Registry.Indices.size();
+	}
+}
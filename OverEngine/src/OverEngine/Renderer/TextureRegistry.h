@@ -0,0 +1,56 @@
+#pragma once
+
+#include "OverEngine/Core/Core.h"
+#include "OverEngine/Renderer/Texture.h"
+
+namespace OverEngine
+{
+	// Weak reference to a texture registered in the TextureRegistry, trivially copyable
+	struct TextureHandle
+	{
+		uint32_t Index = 0;
+		uint32_t Generation = 0; // 0 is never used by a registered texture
+
+		inline bool IsNull() const { return Generation == 0; }
+
+		inline bool operator==(const TextureHandle& other) const { return Index == other.Index && Generation == other.Generation; }
+		inline bool operator!=(const TextureHandle& other) const { return !(*this == other); }
+	};
+
+	/**
+	 * Textures as the renderers see them, with what they need to draw one cached.
+	 * Resolving a handle is an array lookup without virtual calls or reference counting,
+	 * so it's fine on hot paths and from several threads at once while nothing registers.
+	 *
+	 * Registered textures are kept alive until the end of the frame, then dropped when
+	 * nothing else uses them. The cached data is refreshed at the same time.
+	 */
+	class TextureRegistry
+	{
+	public:
+		struct Entry
+		{
+			// The texture to bind, a SubTexture2D's master or the texture itself.
+			// nullptr if the texture is not loaded yet.
+			Ref<Texture2D> Master;
+
+			// Normalized rect inside Master
+			Rect TexRect;
+
+			bool AtlasRegion;
+			bool Opaque;
+		};
+
+		// Returns the handle of `texture`, registering it the first time. Not thread safe.
+		static TextureHandle Register(const Ref<Texture2D>& texture);
+
+		// nullptr if the handle is null or its texture was dropped
+		static const Entry* Get(TextureHandle handle);
+
+		// Called once per frame by Renderer2D::EndFrame
+		static void Update();
+		static void Clear();
+
+		static uint32_t GetTextureCount();
+	};
+}
@@ -0,0 +1,22 @@
+#include "pcheader.h"
+#include "TimerQuery.h"
+
+#include "RendererAPI.h"
+#include "RenderThread.h"
+#include "Platform/OpenGL/OpenGLTimerQuery.h"
+#include "Platform/Null/NullTimerQuery.h"
+
+namespace OverEngine
+{
+	Ref<TimerQuery> TimerQuery::Create()
+	{
+		switch (RendererAPI::GetAPI())
+		{
+		case RendererAPI::API::None:    return CreateRef<NullTimerQuery>();
+		case RendererAPI::API::OpenGL:  return CreateRenderResource<OpenGLTimerQuery>();
+		}
+
+		OE_CORE_ASSERT(false, "Unknown RendererAPI!");
+		return nullptr;
+	}
+}
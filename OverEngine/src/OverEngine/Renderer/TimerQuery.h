@@ -0,0 +1,27 @@
+#pragma once
+
+#include "OverEngine/Core/Core.h"
+
+namespace OverEngine
+{
+	/**
+	 * Measures the GPU time spent on the commands between Begin and End.
+	 * The result is only available a few frames later, poll IsResultAvailable to not stall.
+	 * Queries can't be nested.
+	 */
+	class TimerQuery
+	{
+	public:
+		static Ref<TimerQuery> Create();
+
+		virtual ~TimerQuery() = default;
+
+		virtual void Begin() = 0;
+		virtual void End() = 0;
+
+		virtual bool IsResultAvailable() const = 0;
+
+		// In nanoseconds
+		virtual uint64_t GetResult() const = 0;
+	};
+}
@@ -2,7 +2,9 @@
 #include "VertexArray.h"
 
 #include "RendererAPI.h"
+#include "RenderThread.h"
 #include "Platform/OpenGL/OpenGLVertexArray.h"
+#include "Platform/Null/NullVertexArray.h"
 
 namespace OverEngine
 {
@@ -10,8 +12,8 @@ namespace OverEngine
 	{
 		switch (RendererAPI::GetAPI())
 		{
-		case RendererAPI::API::None:    OE_CORE_ASSERT(false, "RendererAPI::None is currently not supported!"); return nullptr;
-		case RendererAPI::API::OpenGL:  return CreateRef<OpenGLVertexArray>();
+		case RendererAPI::API::None:    return CreateRef<NullVertexArray>();
+		case RendererAPI::API::OpenGL:  return CreateRenderResource<OpenGLVertexArray>();
 		}
 
 		OE_CORE_ASSERT(false, "Unknown RendererAPI!");
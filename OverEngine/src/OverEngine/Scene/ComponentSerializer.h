@@ -1,6 +1,9 @@
 #pragma once
 
 #include "Components.h"
+#include "TilemapComponent.h"
+#include "ParticleEmitter2DComponent.h"
+#include "SpriteAnimatorComponent.h"
 #include "OverEngine/Core/Runtime/Serialization/ObjectSerializer.h"
 #include "OverEngine/Core/AssetManagement/AssetDatabase.h"
 
@@ -56,6 +59,7 @@ namespace OverEngine
 			out << YAML::Key << "ClearColor" << YAML::Value << cc.Camera.GetClearColor();
 
 			out << YAML::Key << "FixedAspectRatio" << YAML::Value << cc.FixedAspectRatio;
+			out << YAML::Key << "CullingMask" << YAML::Value << YAML::Hex << cc.CullingMask;
 
 			return true;
 		};
@@ -80,6 +84,9 @@ namespace OverEngine
 
 			cc.FixedAspectRatio = data["FixedAspectRatio"].as<bool>();
 
+			if (auto cullingMask = data["CullingMask"])
+				cc.CullingMask = cullingMask.as<uint32_t>();
+
 			return true;
 		};
 	};
@@ -113,6 +120,8 @@ namespace OverEngine
 			out << YAML::Key << "Flip" << YAML::Value << (int)sp.Flip;
 
 			out << YAML::Key << "ForceTile" << YAML::Value << sp.ForceTile;
+			out << YAML::Key << "Static" << YAML::Value << sp.Static;
+			out << YAML::Key << "Layer" << YAML::Value << (int)sp.Layer;
 
 			return true;
 		};
@@ -139,8 +148,277 @@ namespace OverEngine
 			if (data["Flip.y"].as<bool>())
 				sp.Flip |= TextureFlip_Y;
 
+			if (auto isStatic = data["Static"])
+				sp.Static = isStatic.as<bool>();
+
+			if (auto layer = data["Layer"])
+				sp.Layer = (uint8_t)std::min(layer.as<uint32_t>(), RenderLayerCount - 1);
+
+			return true;
+		}
+	};
+
+	template<>
+	class ObjectSerializer<TilemapComponent>
+	{
+	public:
+		static bool Serialize(YAML::Emitter& out, const TilemapComponent* object)
+		{
+			const TilemapComponent& tm = *object;
+
+			out << YAML::Key << "Enabled" << YAML::Value << tm.Enabled;
+
+			out << YAML::Key << "TileSet" << YAML::Value;
+			if (tm.TileSet)
+			{
+				out << YAML::Flow << YAML::BeginMap;
+				out << YAML::Key << "Asset" << YAML::Value << YAML::Hex << tm.TileSet->GetGuid();
+				out << YAML::EndMap;
+			}
+			else
+			{
+				out << YAML::Null;
+			}
+
+			out << YAML::Key << "Columns" << YAML::Value << tm.Columns;
+			out << YAML::Key << "Rows" << YAML::Value << tm.Rows;
+			out << YAML::Key << "CellSize" << YAML::Value << tm.CellSize;
+			out << YAML::Key << "Tint" << YAML::Value << tm.Tint;
+			out << YAML::Key << "Layer" << YAML::Value << (int)tm.Layer;
+
+			// Tens of thousands of tiles are way smaller and faster to parse as one base64 blob
+			Vector<uint8_t> tiles = tm.SaveTiles();
+			out << YAML::Key << "Tiles" << YAML::Value << YAML::Binary(tiles.data(), tiles.size());
+
+			return true;
+		};
+
+		static bool Deserialize(YAML::Node data, TilemapComponent* object)
+		{
+			TilemapComponent& tm = *object;
+
+			if (auto enabled = data["Enabled"])
+				tm.Enabled = enabled.as<bool>();
+
+			if (auto tileSet = data["TileSet"]; tileSet && !tileSet.IsNull())
+				tm.TileSet = AssetDatabase::RegisterAndGet<Texture2D>(tileSet["Asset"].as<uint64_t>());
+
+			tm.Columns = std::max(data["Columns"].as<uint32_t>(), 1u);
+			tm.Rows = std::max(data["Rows"].as<uint32_t>(), 1u);
+			tm.CellSize = data["CellSize"].as<Vector2>();
+			tm.Tint = data["Tint"].as<Color>();
+
+			if (auto layer = data["Layer"])
+				tm.Layer = (uint8_t)std::min(layer.as<uint32_t>(), RenderLayerCount - 1);
+
+			if (auto tiles = data["Tiles"])
+			{
+				YAML::Binary blob = tiles.as<YAML::Binary>();
+				if (!tm.LoadTiles(blob.data(), blob.size()))
+				{
+					OE_CORE_ERROR("Invalid tiles in TilemapComponent!");
+					return false;
+				}
+			}
+
+			return true;
+		}
+	};
+
+	template<>
+	class ObjectSerializer<SpriteAnimatorComponent>
+	{
+	public:
+		static bool Serialize(YAML::Emitter& out, const SpriteAnimatorComponent* object)
+		{
+			const SpriteAnimatorComponent& sa = *object;
+
+			out << YAML::Key << "Enabled" << YAML::Value << sa.Enabled;
+
+			out << YAML::Key << "Sheet" << YAML::Value;
+			if (sa.Sheet)
+			{
+				out << YAML::Flow << YAML::BeginMap;
+				out << YAML::Key << "Asset" << YAML::Value << YAML::Hex << sa.Sheet->GetGuid();
+				out << YAML::EndMap;
+			}
+			else
+			{
+				out << YAML::Null;
+			}
+
+			out << YAML::Key << "Columns" << YAML::Value << sa.Columns;
+			out << YAML::Key << "Rows" << YAML::Value << sa.Rows;
+			out << YAML::Key << "Speed" << YAML::Value << sa.Speed;
+			out << YAML::Key << "Playing" << YAML::Value << sa.Playing;
+			out << YAML::Key << "Animation" << YAML::Value << sa.GetAnimation();
+
+			out << YAML::Key << "Animations" << YAML::Value << YAML::BeginSeq;
+			for (const auto& animation : sa.Animations)
+			{
+				out << YAML::BeginMap;
+				out << YAML::Key << "Name" << YAML::Value << animation.Name;
+				out << YAML::Key << "FrameRate" << YAML::Value << animation.FrameRate;
+				out << YAML::Key << "Looping" << YAML::Value << animation.Looping;
+				out << YAML::Key << "Frames" << YAML::Value << YAML::Flow << animation.Frames;
+				out << YAML::EndMap;
+			}
+			out << YAML::EndSeq;
+
+			return true;
+		};
+
+		static bool Deserialize(YAML::Node data, SpriteAnimatorComponent* object)
+		{
+			SpriteAnimatorComponent& sa = *object;
+
+			if (auto enabled = data["Enabled"])
+				sa.Enabled = enabled.as<bool>();
+
+			if (auto sheet = data["Sheet"]; sheet && !sheet.IsNull())
+				sa.Sheet = AssetDatabase::RegisterAndGet<Texture2D>(sheet["Asset"].as<uint64_t>());
+
+			sa.Columns = std::max(data["Columns"].as<uint32_t>(), 1u);
+			sa.Rows = std::max(data["Rows"].as<uint32_t>(), 1u);
+			sa.Speed = data["Speed"].as<float>();
+
+			sa.Animations.clear();
+			for (auto animationNode : data["Animations"])
+			{
+				SpriteAnimation& animation = sa.Animations.emplace_back();
+				animation.Name = animationNode["Name"].as<String>();
+				animation.FrameRate = animationNode["FrameRate"].as<float>();
+				animation.Looping = animationNode["Looping"].as<bool>();
+				animation.Frames = animationNode["Frames"].as<Vector<uint32_t>>();
+			}
+
+			sa.Play(data["Animation"].as<uint32_t>());
+			sa.Playing = data["Playing"].as<bool>();
+
+			return true;
+		}
+	};
+
+	template<>
+	class ObjectSerializer<ParticleEmitter2DComponent>
+	{
+	public:
+		static bool Serialize(YAML::Emitter& out, const ParticleEmitter2DComponent* object)
+		{
+			const ParticleEmitter2DComponent& pe = *object;
+
+			out << YAML::Key << "Enabled" << YAML::Value << pe.Enabled;
+
+			out << YAML::Key << "Emitting" << YAML::Value << pe.Emitting;
+			out << YAML::Key << "Looping" << YAML::Value << pe.Looping;
+			out << YAML::Key << "Duration" << YAML::Value << pe.Duration;
+			out << YAML::Key << "EmissionRate" << YAML::Value << pe.EmissionRate;
+
+			out << YAML::Key << "Bursts" << YAML::Value << YAML::BeginSeq;
+			for (const auto& burst : pe.Bursts)
+			{
+				out << YAML::Flow << YAML::BeginMap;
+				out << YAML::Key << "Time" << YAML::Value << burst.Time;
+				out << YAML::Key << "Count" << YAML::Value << burst.Count;
+				out << YAML::EndMap;
+			}
+			out << YAML::EndSeq;
+
+			out << YAML::Key << "MaxParticles" << YAML::Value << pe.MaxParticles;
+
+			out << YAML::Key << "LifeTime" << YAML::Value << pe.LifeTime;
+			out << YAML::Key << "Velocity" << YAML::Value << pe.Velocity;
+			out << YAML::Key << "VelocityVariation" << YAML::Value << pe.VelocityVariation;
+			out << YAML::Key << "AngularVelocity" << YAML::Value << pe.AngularVelocity;
+			out << YAML::Key << "AngularVelocityVariation" << YAML::Value << pe.AngularVelocityVariation;
+			out << YAML::Key << "BirthSize" << YAML::Value << pe.BirthSize;
+			out << YAML::Key << "DeathSize" << YAML::Value << pe.DeathSize;
+
+			out << YAML::Key << "Sprite" << YAML::Value;
+			if (pe.Sprite)
+			{
+				out << YAML::Flow << YAML::BeginMap;
+				out << YAML::Key << "Asset" << YAML::Value << YAML::Hex << pe.Sprite->GetGuid();
+				out << YAML::EndMap;
+			}
+			else
+			{
+				out << YAML::Null;
+			}
+
+			out << YAML::Key << "BirthColor" << YAML::Value << pe.BirthColor;
+			out << YAML::Key << "DeathColor" << YAML::Value << pe.DeathColor;
+			SerializeCurve(out, "ColorOverLifetime", pe.ColorOverLifetime);
+			SerializeCurve(out, "SizeOverLifetime", pe.SizeOverLifetime);
+			out << YAML::Key << "Layer" << YAML::Value << (int)pe.Layer;
+
+			return true;
+		};
+
+		static bool Deserialize(YAML::Node data, ParticleEmitter2DComponent* object)
+		{
+			ParticleEmitter2DComponent& pe = *object;
+
+			if (auto enabled = data["Enabled"])
+				pe.Enabled = enabled.as<bool>();
+
+			pe.Emitting = data["Emitting"].as<bool>();
+			pe.Looping = data["Looping"].as<bool>();
+			pe.Duration = data["Duration"].as<float>();
+			pe.EmissionRate = data["EmissionRate"].as<float>();
+
+			pe.Bursts.clear();
+			for (auto burst : data["Bursts"])
+				pe.Bursts.push_back({ burst["Time"].as<float>(), burst["Count"].as<uint32_t>() });
+
+			pe.MaxParticles = data["MaxParticles"].as<uint32_t>();
+
+			pe.LifeTime = data["LifeTime"].as<float>();
+			pe.Velocity = data["Velocity"].as<Vector2>();
+			pe.VelocityVariation = data["VelocityVariation"].as<Vector2>();
+			pe.AngularVelocity = data["AngularVelocity"].as<float>();
+			pe.AngularVelocityVariation = data["AngularVelocityVariation"].as<float>();
+			pe.BirthSize = data["BirthSize"].as<Vector2>();
+			pe.DeathSize = data["DeathSize"].as<Vector2>();
+
+			if (auto sprite = data["Sprite"]; sprite && !sprite.IsNull())
+				pe.Sprite = AssetDatabase::RegisterAndGet<Texture2D>(sprite["Asset"].as<uint64_t>());
+
+			pe.BirthColor = data["BirthColor"].as<Color>();
+			pe.DeathColor = data["DeathColor"].as<Color>();
+			DeserializeCurve(data["ColorOverLifetime"], pe.ColorOverLifetime);
+			DeserializeCurve(data["SizeOverLifetime"], pe.SizeOverLifetime);
+
+			if (auto layer = data["Layer"])
+				pe.Layer = (uint8_t)std::min(layer.as<uint32_t>(), RenderLayerCount - 1);
+
 			return true;
 		}
+
+	private:
+		template<typename T>
+		static void SerializeCurve(YAML::Emitter& out, const char* name, const LifetimeCurve<T>& curve)
+		{
+			out << YAML::Key << name << YAML::Value << YAML::BeginSeq;
+			for (const auto& key : curve.GetKeys())
+			{
+				out << YAML::Flow << YAML::BeginMap;
+				out << YAML::Key << "Time" << YAML::Value << key.Time;
+				out << YAML::Key << "Value" << YAML::Value << key.Value;
+				out << YAML::EndMap;
+			}
+			out << YAML::EndSeq;
+		}
+
+		template<typename T>
+		static void DeserializeCurve(YAML::Node data, LifetimeCurve<T>& curve)
+		{
+			Vector<typename LifetimeCurve<T>::Key> keys;
+			for (auto key : data)
+				keys.push_back({ key["Time"].as<float>(), key["Value"].as<T>() });
+
+			curve.SetKeys(std::move(keys));
+		}
 	};
 
 	template<>
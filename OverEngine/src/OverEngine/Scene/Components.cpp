@@ -19,6 +19,8 @@ namespace OverEngine
 			ADD_PUBLIC_MEMBER_PROPERTY(SpriteRendererComponent, Offset)
 			ADD_PUBLIC_MEMBER_ENUM_PROPERTY(SpriteRendererComponent, Flip, PropertyHint(PropertyHintType::Flags, { { 0, "None" }, { BIT(0), "X" }, { BIT(1), "Y" } }))
 			ADD_PUBLIC_MEMBER_PROPERTY(SpriteRendererComponent, ForceTile)
+			ADD_PUBLIC_MEMBER_PROPERTY(SpriteRendererComponent, Static)
+			ADD_PUBLIC_MEMBER_PROPERTY(SpriteRendererComponent, Layer)
 		}
 
 		return typeInfo;
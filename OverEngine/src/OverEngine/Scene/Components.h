@@ -9,6 +9,7 @@
 #include "OverEngine/Core/Random.h"
 
 #include "OverEngine/Renderer/Texture.h"
+#include "OverEngine/Renderer/TextureRegistry.h"
 
 #include "OverEngine/Physics/RigidBody2D.h"
 #include "OverEngine/Physics/Collider2D.h"
@@ -59,6 +60,9 @@ namespace OverEngine
 	/// Renderer Components ////////////////////////////////
 	////////////////////////////////////////////////////////
 
+	// Renderable components have a layer, cameras only draw the layers in their CullingMask
+	static constexpr uint32_t RenderLayerCount = 32;
+
 	struct CameraComponent : public Component
 	{
 		OE_CLASS_NO_REFLECT_PUBLIC(CameraComponent, Component)
@@ -66,6 +70,9 @@ namespace OverEngine
 		SceneCamera Camera;
 		bool FixedAspectRatio = false;
 
+		// Bit per render layer
+		uint32_t CullingMask = UINT32_MAX;
+
 		CameraComponent(const CameraComponent&) = default;
 
 		CameraComponent(const Entity& entity, const SceneCamera& camera)
@@ -90,6 +97,20 @@ namespace OverEngine
 		// Useful for SubTextures
 		bool ForceTile = false;
 
+		// Baked into a retained batch with its neighbours. Transform changes are picked up
+		// automatically, other changes need a call to Scene::InvalidateSprite.
+		bool Static = false;
+
+		// Less than RenderLayerCount, see CameraComponent::CullingMask
+		uint8_t Layer = 0;
+
+		// Part of Sprite to draw, normalized inside it. Written by SpriteAnimatorComponent, not saved.
+		Rect TexRect = Rect(0.0f, 0.0f, 1.0f, 1.0f);
+
+		// Sprite as the renderer sees it, refreshed by the Scene whenever Sprite changes
+		TextureHandle SpriteHandle;
+		const Texture2D* SpriteHandleSource = nullptr;
+
 		SpriteRendererComponent(const SpriteRendererComponent&) = default;
 
 		SpriteRendererComponent(const Entity& entity, Ref<Texture2D> sprite = nullptr)
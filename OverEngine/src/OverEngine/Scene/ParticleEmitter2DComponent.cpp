@@ -0,0 +1,114 @@
+#include "pcheader.h"
+#include "ParticleEmitter2DComponent.h"
+
+#include "OverEngine/Core/Runtime/Reflection/TypeInfo.h"
+
+namespace OverEngine
+{
+	ObjectTypeInfo* ParticleEmitter2DComponent::Reflect()
+	{
+		static ObjectTypeInfo* typeInfo = nullptr;
+
+		if (!typeInfo)
+		{
+			typeInfo = new ObjectTypeInfo(GetStaticClassName(), sizeof(ParticleEmitter2DComponent), dynamic_cast<ObjectTypeInfo*>(TypeResolver<Component>::Get()));
+
+			ADD_PUBLIC_MEMBER_PROPERTY(ParticleEmitter2DComponent, Emitting)
+			ADD_PUBLIC_MEMBER_PROPERTY(ParticleEmitter2DComponent, Looping)
+			ADD_PUBLIC_MEMBER_PROPERTY(ParticleEmitter2DComponent, Duration)
+			ADD_PUBLIC_MEMBER_PROPERTY(ParticleEmitter2DComponent, EmissionRate)
+			ADD_PUBLIC_MEMBER_PROPERTY(ParticleEmitter2DComponent, MaxParticles)
+			ADD_PUBLIC_MEMBER_PROPERTY(ParticleEmitter2DComponent, LifeTime)
+			ADD_PUBLIC_MEMBER_PROPERTY(ParticleEmitter2DComponent, Velocity)
+			ADD_PUBLIC_MEMBER_PROPERTY(ParticleEmitter2DComponent, VelocityVariation)
+			ADD_PUBLIC_MEMBER_PROPERTY(ParticleEmitter2DComponent, AngularVelocity)
+			ADD_PUBLIC_MEMBER_PROPERTY(ParticleEmitter2DComponent, AngularVelocityVariation)
+			ADD_PUBLIC_MEMBER_PROPERTY(ParticleEmitter2DComponent, BirthSize)
+			ADD_PUBLIC_MEMBER_PROPERTY(ParticleEmitter2DComponent, DeathSize)
+			ADD_PUBLIC_MEMBER_PROPERTY(ParticleEmitter2DComponent, Sprite)
+			ADD_PUBLIC_MEMBER_PROPERTY(ParticleEmitter2DComponent, BirthColor)
+			ADD_PUBLIC_MEMBER_PROPERTY(ParticleEmitter2DComponent, DeathColor)
+			ADD_PUBLIC_MEMBER_PROPERTY(ParticleEmitter2DComponent, Layer)
+		}
+
+		return typeInfo;
+	}
+
+	uint32_t ParticleEmitter2DComponent::CountBursts(float begin, float end) const
+	{
+		uint32_t count = 0;
+		for (const Burst& burst : Bursts)
+		{
+			if (burst.Time >= begin && burst.Time < end)
+				count += burst.Count;
+		}
+		return count;
+	}
+
+	void ParticleEmitter2DComponent::Update(TimeStep deltaTime, const Mat4x4& localToWorld)
+	{
+		float dt = deltaTime;
+		m_Particles.SetPoolSize(MaxParticles);
+
+		uint32_t count = 0;
+		if (Emitting && !m_Finished && Duration > 0.0f)
+		{
+			float cycleEnd = m_CycleTime + dt;
+
+			m_PendingEmission += EmissionRate * dt;
+			count = (uint32_t)m_PendingEmission;
+			m_PendingEmission -= count;
+
+			count += CountBursts(m_CycleTime, cycleEnd);
+
+			if (cycleEnd >= Duration)
+			{
+				if (Looping)
+				{
+					// Only the start of the next cycle, updates are assumed shorter than a cycle
+					cycleEnd = std::fmod(cycleEnd, Duration);
+					count += CountBursts(0.0f, cycleEnd);
+				}
+				else
+				{
+					m_Finished = true;
+				}
+			}
+
+			m_CycleTime = cycleEnd;
+		}
+
+		if (count > 0)
+		{
+			Particle2DProps props;
+			props.Position = localToWorld[3];
+
+			props.Velocity = Velocity;
+			props.VelocityVariation = VelocityVariation;
+			props.AngularVelocity = glm::radians(AngularVelocity);
+			props.AngularVelocityVariation = glm::radians(AngularVelocityVariation);
+
+			props.BirthSize = BirthSize;
+			props.DeathSize = DeathSize;
+			props.LifeTime = LifeTime;
+
+			props.RenderingProps.Sprite = Sprite;
+			props.RenderingProps.BirthColor = BirthColor;
+			props.RenderingProps.DeathColor = DeathColor;
+			props.RenderingProps.ColorOverLifetime = &ColorOverLifetime;
+			props.RenderingProps.SizeOverLifetime = &SizeOverLifetime;
+
+			m_Particles.Emit(props, count);
+		}
+
+		m_Particles.Update(deltaTime);
+	}
+
+	void ParticleEmitter2DComponent::Restart()
+	{
+		m_Particles.Clear();
+		m_CycleTime = 0.0f;
+		m_PendingEmission = 0.0f;
+		m_Finished = false;
+	}
+}
@@ -0,0 +1,86 @@
+#pragma once
+
+#include "OverEngine/Core/Math/Math.h"
+#include "OverEngine/Core/Time/TimeStep.h"
+#include "OverEngine/Renderer/ParticleSystem2D.h"
+
+#include "Components.h"
+
+namespace OverEngine
+{
+	/**
+	 * Emits particles from the entity's position, simulated and drawn by the Scene.
+	 * Particles live in world space, moving the entity doesn't move the ones already emitted.
+	 *
+	 * Emission runs in cycles of `Duration` seconds, with `EmissionRate` particles per
+	 * second plus the bursts timed inside the cycle.
+	 */
+	struct ParticleEmitter2DComponent : public Component
+	{
+		OE_CLASS_PUBLIC(ParticleEmitter2DComponent, Component)
+
+		struct Burst
+		{
+			float Time = 0.0f; // Since the start of the cycle
+			uint32_t Count = 10;
+
+			bool operator==(const Burst& other) const { return Time == other.Time && Count == other.Count; }
+		};
+
+		// Emission
+		bool Emitting = true;
+		bool Looping = true;
+		float Duration = 5.0f;
+		float EmissionRate = 10.0f;
+		Vector<Burst> Bursts;
+
+		// Upper bound of the alive particles
+		uint32_t MaxParticles = 1000;
+
+		// Particles
+		float LifeTime = 1.0f;
+		Vector2 Velocity = Vector2(0.0f);
+		Vector2 VelocityVariation = Vector2(1.0f);
+		float AngularVelocity = 0.0f; // Degrees per second
+		float AngularVelocityVariation = 0.0f;
+		Vector2 BirthSize = Vector2(1.0f);
+		Vector2 DeathSize = Vector2(0.0f);
+
+		// Rendering
+		Ref<Texture2D> Sprite;
+		Color BirthColor = Color(1.0f);
+		Color DeathColor = Color(1.0f, 1.0f, 1.0f, 0.0f);
+		LifetimeCurve<Color> ColorOverLifetime;
+		LifetimeCurve<float> SizeOverLifetime;
+
+		// Less than RenderLayerCount, see CameraComponent::CullingMask
+		uint8_t Layer = 0;
+
+		ParticleEmitter2DComponent(const ParticleEmitter2DComponent&) = default;
+
+		ParticleEmitter2DComponent(const Entity& entity, Ref<Texture2D> sprite = nullptr)
+			: Component(entity), Sprite(sprite) {}
+
+		// Emits then updates the particles. Only touches this component, called by the Scene from worker threads.
+		void Update(TimeStep deltaTime, const Mat4x4& localToWorld);
+
+		// Removes the particles and starts a new cycle
+		void Restart();
+
+		inline const ParticleSystem2D& GetParticles() const { return m_Particles; }
+		inline ParticleSystem2D& GetParticles() { return m_Particles; }
+
+		inline float GetCycleTime() const { return m_CycleTime; }
+
+	private:
+		// Bursts timed in [begin, end) of the cycle
+		uint32_t CountBursts(float begin, float end) const;
+
+	private:
+		ParticleSystem2D m_Particles = ParticleSystem2D(0);
+
+		float m_CycleTime = 0.0f;
+		float m_PendingEmission = 0.0f; // Fraction of a particle left from the previous updates
+		bool m_Finished = false; // Non looping cycle is over
+	};
+}
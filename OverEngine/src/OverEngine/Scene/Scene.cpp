@@ -4,11 +4,15 @@
 #include "Entity.h"
 #include "Components.h"
 #include "TransformComponent.h"
+#include "TilemapComponent.h"
+#include "ParticleEmitter2DComponent.h"
+#include "SpriteAnimatorComponent.h"
 
 #include "OverEngine/Renderer/Renderer2D.h"
 #include "OverEngine/Physics/PhysicsWorld2D.h"
 
 #include "OverEngine/Core/Random.h"
+#include "OverEngine/Core/Threading/ThreadPool.h"
 
 #include "OverEngine/Core/Runtime/Serialization/YamlConverters.h"
 #include <yaml-cpp/yaml.h>
@@ -19,12 +23,17 @@ namespace OverEngine
 	Scene::Scene(const SceneSettings& settings)
 		: m_PhysicsWorld2D(nullptr)
 	{
+		m_Registry.on_construct<SpriteRendererComponent>().connect<&Scene::OnSpriteRendererConstruct>(*this);
+		m_Registry.on_destroy<SpriteRendererComponent>().connect<&Scene::OnSpriteRendererDestroy>(*this);
 	}
 
 	Scene::Scene(Scene& other)
 		: m_Registry(), m_ViewportWidth(other.m_ViewportWidth), m_ViewportHeight(other.m_ViewportHeight),
 		  m_RootHandles(other.m_RootHandles), m_ComponentList(other.m_ComponentList)
 	{
+		m_Registry.on_construct<SpriteRendererComponent>().connect<&Scene::OnSpriteRendererConstruct>(*this);
+		m_Registry.on_destroy<SpriteRendererComponent>().connect<&Scene::OnSpriteRendererDestroy>(*this);
+
 		const auto& reg = other.m_Registry;
 		m_Registry.assign(reg.data(), reg.data() + reg.size());
 
@@ -32,9 +41,18 @@ namespace OverEngine
 		CopyComponentsFrom<IDComponent>(other);
 		CopyComponentsFrom<TransformComponent>(other);
 		CopyComponentsFrom<SpriteRendererComponent>(other);
+		CopyComponentsFrom<SpriteAnimatorComponent>(other);
+		CopyComponentsFrom<TilemapComponent>(other);
+		CopyComponentsFrom<ParticleEmitter2DComponent>(other);
 		CopyComponentsFrom<CameraComponent>(other);
 		CopyComponentsFrom<RigidBody2DComponent>(other);
 		CopyComponentsFrom<Colliders2DComponent>(other);
+
+		// The copied flags belong to the other scene's sprite index
+		m_Registry.view<TransformComponent>().each([](TransformComponent& tc)
+		{
+			tc.m_ChangedFlags &= ~TransformComponent::ChangedFlags_Changed;
+		});
 	}
 
 	Scene::~Scene()
@@ -71,6 +89,8 @@ namespace OverEngine
 	{
 		OnPhysicsUpdate(deltaTime); // TODO: use a FixedUpdate (just like Unity)
 		OnScriptsUpdate(deltaTime);
+		OnAnimationsUpdate(deltaTime);
+		OnParticlesUpdate(deltaTime);
 		OnRender();
 	}
 
@@ -134,6 +154,67 @@ namespace OverEngine
 		});
 	}
 
+	void Scene::OnAnimationsUpdate(TimeStep deltaTime)
+	{
+		OE_PROFILE_FUNCTION();
+
+		float dt = deltaTime;
+		m_Registry.view<SpriteAnimatorComponent, SpriteRendererComponent>().each([this, dt](entt::entity entity, auto& animator, auto& sprite)
+		{
+			if (!animator.Enabled || !animator.Advance(dt))
+				return;
+
+			sprite.TexRect = animator.GetFrameRect(animator.GetSheetFrame());
+
+			// Only touches the reference count when the sheet changes
+			if (sprite.Sprite != animator.Sheet)
+				sprite.Sprite = animator.Sheet;
+
+			if (sprite.Static)
+				InvalidateSprite(entity);
+		});
+	}
+
+	// Particles below which it's not worth waking the workers
+	static constexpr uint32_t MinParticlesPerDispatch = 4096;
+
+	void Scene::OnParticlesUpdate(TimeStep deltaTime)
+	{
+		OE_PROFILE_FUNCTION();
+
+		// Transforms are read here, getting them may update the cached matrices
+		uint32_t particleCount = 0;
+		m_UpdatedEmitters.clear();
+		m_EmitterTransforms.clear();
+		m_Registry.view<ParticleEmitter2DComponent, TransformComponent>().each([this, &particleCount](auto& emitter, auto& tc)
+		{
+			if (!emitter.Enabled)
+				return;
+
+			m_UpdatedEmitters.push_back(&emitter);
+			m_EmitterTransforms.push_back(tc.GetLocalToWorld());
+			particleCount += emitter.GetParticles().GetParticleCount();
+		});
+
+		uint32_t emitterCount = (uint32_t)m_UpdatedEmitters.size();
+		if (emitterCount <= 1 || particleCount < MinParticlesPerDispatch)
+		{
+			for (uint32_t i = 0; i < emitterCount; i++)
+				m_UpdatedEmitters[i]->Update(deltaTime, m_EmitterTransforms[i]);
+		}
+		else
+		{
+			ThreadPool::Get().Dispatch(emitterCount, [this, deltaTime](uint32_t i)
+			{
+				m_UpdatedEmitters[i]->Update(deltaTime, m_EmitterTransforms[i]);
+			});
+		}
+
+		// Not on the workers, dropping a group may release its sprite's texture
+		for (ParticleEmitter2DComponent* emitter : m_UpdatedEmitters)
+			emitter->GetParticles().ReleaseEmptyGroups();
+	}
+
 	void Scene::OnScenePlay()
 	{
 		InitializePhysics();
@@ -211,39 +292,352 @@ namespace OverEngine
 		});
 	}
 
-	void Scene::RenderSprites()
+	void Scene::OnSpriteRendererConstruct(entt::registry& registry, entt::entity entity)
 	{
-		auto spritesGroup = m_Registry.group<SpriteRendererComponent>(entt::get<TransformComponent>);
-		for (auto sp : spritesGroup)
+		// Added to the index on the next UpdateSpriteIndex, the transform may not exist yet
+		m_DirtySprites.push_back(entity);
+	}
+
+	void Scene::OnSpriteRendererDestroy(entt::registry& registry, entt::entity entity)
+	{
+		RemoveDynamicSprite(entity);
+		RemoveStaticSprite(entity);
+	}
+
+	void Scene::OnTransformChanged(entt::entity entity)
+	{
+		// The changed flag stays set without a sprite, so the entity stops notifying.
+		// OnSpriteRendererConstruct clears it through UpdateSpriteIndex if one is added.
+		if (!m_Registry.has<SpriteRendererComponent>(entity))
+			return;
+
+		m_DirtySprites.push_back(entity);
+	}
+
+	void Scene::InvalidateSprite(entt::entity entity)
+	{
+		m_DirtySprites.push_back(entity);
+	}
+
+	// User data of the grid proxies whose sprite is not in m_ExtractedSprites
+	static constexpr uint32_t NotExtracted = UINT32_MAX;
+
+	void Scene::UpdateSpriteIndex()
+	{
+		for (auto entity : m_DirtySprites)
 		{
-			auto& sprite = spritesGroup.get<SpriteRendererComponent>(sp);
-			if (sprite.Enabled)
+			if (!m_Registry.valid(entity))
+				continue;
+
+			auto* tc = m_Registry.try_get<TransformComponent>(entity);
+			if (!tc)
+				continue;
+
+			// Let the next change notify us again
+			tc->m_ChangedFlags &= ~TransformComponent::ChangedFlags_Changed;
+
+			auto* sprite = m_Registry.try_get<SpriteRendererComponent>(entity);
+			if (!sprite)
+				continue;
+
+			AABB2D bounds = AABB2D::FromQuad(tc->GetLocalToWorld());
+
+			if (sprite->Static)
 			{
-				auto& transform = spritesGroup.get<TransformComponent>(sp);
+				RemoveDynamicSprite(entity);
+				AddStaticSprite(entity, bounds, sprite->Layer);
+				continue;
+			}
 
-				if (sprite.Sprite && !sprite.Sprite->IsReference())
-				{
-					TexturedQuadProps props;
-					props.Tint      = sprite.Tint;
-					props.Sprite    = sprite.Sprite;
-					props.Tiling    = sprite.Tiling;
-					props.Offset    = sprite.Offset;
-					props.Flip      = sprite.Flip;
-					props.ForceTile = sprite.ForceTile;
-
-					Renderer2D::DrawQuad(transform.GetLocalToWorld(), props);
-				}
-				else
-				{
-					Renderer2D::DrawQuad(transform.GetLocalToWorld(), sprite.Tint);
-				}
+			RemoveStaticSprite(entity);
+
+			auto it = m_SpriteProxies.find(entity);
+			if (it != m_SpriteProxies.end())
+				m_SpriteIndex.Update(it->second, bounds);
+			else
+				m_SpriteProxies[entity] = m_SpriteIndex.Insert(bounds, NotExtracted);
+		}
+
+		m_DirtySprites.clear();
+	}
+
+	void Scene::RemoveDynamicSprite(entt::entity entity)
+	{
+		auto it = m_SpriteProxies.find(entity);
+		if (it != m_SpriteProxies.end())
+		{
+			m_SpriteIndex.Remove(it->second);
+			m_SpriteProxies.erase(it);
+		}
+	}
+
+	static inline uint32_t GetLayerMask(uint8_t layer)
+	{
+		return layer < RenderLayerCount ? 1u << layer : 0u;
+	}
+
+	// Side of the square areas static sprites are grouped by
+	static constexpr float StaticChunkSize = 64.0f;
+
+	// Each layer has its own chunks, so cameras can skip them as a whole
+	static uint64_t GetStaticChunkKey(const AABB2D& bounds, uint8_t layer)
+	{
+		// Clamped, anything that far away (or NaN) just shares the border chunks
+		constexpr float limit = (float)(1 << 26);
+		Vector2 chunk = glm::floor(bounds.GetCenter() / StaticChunkSize);
+		int32_t x = (int32_t)(chunk.x > -limit ? (chunk.x < limit ? chunk.x : limit) : -limit);
+		int32_t y = (int32_t)(chunk.y > -limit ? (chunk.y < limit ? chunk.y : limit) : -limit);
+
+		// 29 bits per coordinate, the layer on top
+		constexpr uint64_t coordinateMask = (1ull << 29) - 1;
+		return ((uint64_t)layer << 58) | (((uint64_t)(uint32_t)x & coordinateMask) << 29) | ((uint64_t)(uint32_t)y & coordinateMask);
+	}
+
+	void Scene::AddStaticSprite(entt::entity entity, const AABB2D& bounds, uint8_t layer)
+	{
+		uint64_t key = GetStaticChunkKey(bounds, layer);
+
+		auto it = m_StaticSpriteChunkKeys.find(entity);
+		if (it != m_StaticSpriteChunkKeys.end())
+		{
+			if (it->second == key)
+			{
+				m_StaticChunks[key].Dirty = true;
+				return;
+			}
+
+			RemoveStaticSprite(entity);
+		}
+
+		auto& chunk = m_StaticChunks[key];
+		chunk.Sprites.push_back(entity);
+		chunk.LayerMask = GetLayerMask(layer);
+		chunk.Dirty = true;
+
+		m_StaticSpriteChunkKeys[entity] = key;
+	}
+
+	void Scene::RemoveStaticSprite(entt::entity entity)
+	{
+		auto it = m_StaticSpriteChunkKeys.find(entity);
+		if (it == m_StaticSpriteChunkKeys.end())
+			return;
+
+		auto chunkIt = m_StaticChunks.find(it->second);
+		auto& sprites = chunkIt->second.Sprites;
+
+		*std::find(sprites.begin(), sprites.end(), entity) = sprites.back();
+		sprites.pop_back();
+
+		if (sprites.empty())
+			m_StaticChunks.erase(chunkIt);
+		else
+			chunkIt->second.Dirty = true;
+
+		m_StaticSpriteChunkKeys.erase(it);
+	}
+
+	// Sprites per SubmissionContext below which it's not worth waking the workers
+	static constexpr uint32_t MinSpritesPerContext = 1024;
+
+	// Reused between frames to keep their memory, filled by the workers and submitted from the main thread
+	static Vector<Renderer2D::SubmissionContext> s_SpriteContexts;
+
+	// Registers the sprite's texture if it changed (or was dropped by the registry), main thread only
+	static void UpdateSpriteHandle(SpriteRendererComponent& sprite)
+	{
+		if (sprite.Sprite.get() == sprite.SpriteHandleSource && (!sprite.Sprite || TextureRegistry::Get(sprite.SpriteHandle)))
+			return;
+
+		sprite.SpriteHandle = sprite.Sprite ? TextureRegistry::Register(sprite.Sprite) : TextureHandle();
+		sprite.SpriteHandleSource = sprite.Sprite.get();
+	}
+
+	static void ExtractSprite(SpriteRenderData& data, SpriteRendererComponent& sprite, TransformComponent& transform)
+	{
+		UpdateSpriteHandle(sprite);
+
+		data.Transform = transform.GetLocalToWorld();
+		data.LayerMask = GetLayerMask(sprite.Layer);
+
+		// Textures which are not loaded are drawn flat colored
+		data.Props.Tint      = sprite.Tint;
+		data.Props.Sprite    = sprite.SpriteHandle;
+		data.Props.Tiling    = sprite.Tiling;
+		data.Props.Offset    = sprite.Offset;
+		data.Props.Flip      = sprite.Flip;
+		data.Props.ForceTile = sprite.ForceTile;
+		data.Props.TexRect   = sprite.TexRect;
+	}
+
+	// Draws directly through Renderer2D when `context` is nullptr
+	static inline void SubmitSprite(const SpriteRenderData& sprite, Renderer2D::SubmissionContext* context)
+	{
+		if (context)
+			context->DrawQuad(sprite.Transform, sprite.Props);
+		else
+			Renderer2D::DrawQuad(sprite.Transform, sprite.Props);
+	}
+
+	void Scene::RebuildStaticChunk(StaticSpriteChunk& chunk)
+	{
+		OE_PROFILE_FUNCTION();
+
+		// Same order as if they were drawn one by one
+		std::sort(chunk.Sprites.begin(), chunk.Sprites.end());
+
+		auto view = m_Registry.view<SpriteRendererComponent, TransformComponent>();
+
+		Renderer2D::SubmissionContext context;
+		SpriteRenderData data;
+
+		chunk.Bounds = AABB2D::FromQuad(view.get<TransformComponent>(chunk.Sprites[0]).GetLocalToWorld());
+		for (auto entity : chunk.Sprites)
+		{
+			auto& transform = view.get<TransformComponent>(entity);
+
+			AABB2D bounds = AABB2D::FromQuad(transform.GetLocalToWorld());
+			chunk.Bounds.Min = glm::min(chunk.Bounds.Min, bounds.Min);
+			chunk.Bounds.Max = glm::max(chunk.Bounds.Max, bounds.Max);
+
+			auto& sprite = view.get<SpriteRendererComponent>(entity);
+			if (!sprite.Enabled)
+				continue;
+
+			ExtractSprite(data, sprite, transform);
+			SubmitSprite(data, &context);
+		}
+
+		chunk.Batch.Build(context);
+		chunk.Dirty = false;
+	}
+
+	void Scene::ExtractSprites()
+	{
+		OE_PROFILE_FUNCTION();
+
+		UpdateSpriteIndex();
+
+		for (auto& [key, chunk] : m_StaticChunks)
+		{
+			if (chunk.Dirty)
+				RebuildStaticChunk(chunk);
+		}
+
+		m_Registry.view<TilemapComponent, TransformComponent>().each([](auto& tilemap, auto& tc)
+		{
+			tilemap.UpdateChunks(tc.GetLocalToWorld());
+		});
+
+		auto view = m_Registry.view<SpriteRendererComponent, TransformComponent>();
+
+		m_ExtractedSprites.clear();
+		for (const auto& [entity, proxy] : m_SpriteProxies)
+		{
+			auto& sprite = view.get<SpriteRendererComponent>(entity);
+			if (!sprite.Enabled)
+			{
+				m_SpriteIndex.SetUserData(proxy, NotExtracted);
+				continue;
 			}
+
+			m_SpriteIndex.SetUserData(proxy, (uint32_t)m_ExtractedSprites.size());
+			ExtractSprite(m_ExtractedSprites.emplace_back(), sprite, view.get<TransformComponent>(entity));
+		}
+	}
+
+	void Scene::RenderSprites(const Mat4x4& viewProjection, uint32_t cullingMask)
+	{
+		AABB2D viewBounds = AABB2D::FromViewProjection(viewProjection);
+
+		m_VisibleStaticBatches.clear();
+		for (const auto& [key, chunk] : m_StaticChunks)
+		{
+			if ((chunk.LayerMask & cullingMask) && chunk.Bounds.Overlaps(viewBounds))
+				m_VisibleStaticBatches.push_back(&chunk.Batch);
+		}
+
+		m_Registry.view<TilemapComponent>().each([this, &viewBounds, cullingMask](auto& tilemap)
+		{
+			if (!tilemap.Enabled || !(GetLayerMask(tilemap.Layer) & cullingMask))
+				return;
+
+			for (const auto& [key, chunk] : tilemap.GetChunks())
+			{
+				if (chunk.Bounds.Overlaps(viewBounds))
+					m_VisibleStaticBatches.push_back(&chunk.Batch);
+			}
+		});
+
+		// Opaque static sprites and tiles first, they cost nothing per sprite and hide what's behind them
+		for (const auto* batch : m_VisibleStaticBatches)
+			Renderer2D::DrawStaticBatch(*batch, StaticBatchPart::Opaque);
+
+		m_VisibleSprites.clear();
+		m_SpriteIndex.Query(viewBounds, [this, cullingMask](uint32_t index)
+		{
+			if (index != NotExtracted && (m_ExtractedSprites[index].LayerMask & cullingMask))
+				m_VisibleSprites.push_back(index);
+		});
+
+		// Keep the submission order of the extraction (by entity), independent of the grid layout
+		std::sort(m_VisibleSprites.begin(), m_VisibleSprites.end());
+		SubmitVisibleSprites();
+
+		// Translucent static sprites and tiles over the dynamic ones, without hiding those behind them
+		for (const auto* batch : m_VisibleStaticBatches)
+			Renderer2D::DrawStaticBatch(*batch, StaticBatchPart::Transparent);
+
+		m_Registry.view<ParticleEmitter2DComponent>().each([&viewBounds, cullingMask](auto& emitter)
+		{
+			const ParticleSystem2D& particles = emitter.GetParticles();
+			if (emitter.Enabled && (GetLayerMask(emitter.Layer) & cullingMask) && particles.GetParticleCount() > 0 && particles.GetBounds().Overlaps(viewBounds))
+				emitter.GetParticles().Render();
+		});
+	}
+
+	void Scene::SubmitVisibleSprites()
+	{
+		ThreadPool& pool = ThreadPool::Get();
+		uint32_t spriteCount = (uint32_t)m_VisibleSprites.size();
+		uint32_t contextCount = std::min(spriteCount / MinSpritesPerContext, pool.GetThreadCount() + 1);
+
+		if (contextCount <= 1)
+		{
+			for (uint32_t index : m_VisibleSprites)
+				SubmitSprite(m_ExtractedSprites[index], nullptr);
+			return;
+		}
+
+		if (s_SpriteContexts.size() < contextCount)
+			s_SpriteContexts.resize(contextCount);
+
+		// Contiguous ranges, so submitting the contexts in order keeps the serial order.
+		// The workers only read the extracted sprites.
+		uint32_t spritesPerContext = (spriteCount + contextCount - 1) / contextCount;
+		pool.Dispatch(contextCount, [&](uint32_t i)
+		{
+			uint32_t begin = i * spritesPerContext;
+			uint32_t end = std::min(begin + spritesPerContext, spriteCount);
+
+			for (uint32_t j = begin; j < end; j++)
+				SubmitSprite(m_ExtractedSprites[m_VisibleSprites[j]], &s_SpriteContexts[i]);
+		});
+
+		// Clearing right away so the contexts don't keep the textures alive
+		for (uint32_t i = 0; i < contextCount; i++)
+		{
+			Renderer2D::Submit(s_SpriteContexts[i]);
+			s_SpriteContexts[i].Clear();
 		}
 	}
 
 	bool Scene::OnRender()
 	{
 		bool anyCamera = false;
+
+		// Once for all the cameras
+		ExtractSprites();
 		
 		m_Registry.group<CameraComponent>(entt::get<TransformComponent>).each([&anyCamera, this](auto entity, auto& cc, auto& tc)
 		{
@@ -254,8 +648,9 @@ namespace OverEngine
 				RenderCommand::SetClearColor(cc.Camera.GetClearColor());
 				RenderCommand::Clear(cc.Camera.GetClearFlags());
 
-				Renderer2D::BeginScene(glm::inverse(tc.GetLocalToWorld()), cc.Camera);
-				RenderSprites();
+				Mat4x4 viewMatrix = glm::inverse(tc.GetLocalToWorld());
+				Renderer2D::BeginScene(viewMatrix, cc.Camera);
+				RenderSprites(cc.Camera.GetProjection() * viewMatrix, cc.CullingMask);
 				Renderer2D::EndScene();
 			}
 		});
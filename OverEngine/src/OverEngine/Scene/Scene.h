@@ -4,6 +4,8 @@
 #include "OverEngine/Core/Random.h"
 #include "OverEngine/Physics/PhysicsWorld2D.h"
 #include "OverEngine/Core/AssetManagement/Asset.h"
+#include "OverEngine/Scene/SpatialGrid2D.h"
+#include "OverEngine/Renderer/Renderer2D.h"
 
 #include <entt.hpp>
 
@@ -22,6 +24,15 @@ namespace OverEngine
 	};
 
 	class SceneSerializer;
+	struct ParticleEmitter2DComponent;
+
+	// Everything needed to draw a sprite, gathered once per frame by Scene::ExtractSprites
+	struct SpriteRenderData
+	{
+		Mat4x4 Transform;
+		SpriteQuadProps Props;
+		uint32_t LayerMask;
+	};
 
 	class Scene : public Asset
 	{
@@ -40,6 +51,10 @@ namespace OverEngine
 		void OnUpdate(TimeStep deltaTime);
 		void OnPhysicsUpdate(TimeStep deltaTime);
 		void OnScriptsUpdate(TimeStep deltaTime);
+		// Advances the SpriteAnimatorComponents and updates their sprites
+		void OnAnimationsUpdate(TimeStep deltaTime);
+		// Emitters are independent, busy scenes update them on the ThreadPool
+		void OnParticlesUpdate(TimeStep deltaTime);
 
 		void OnScenePlay();
 		void InitializePhysics();
@@ -47,7 +62,14 @@ namespace OverEngine
 
 		// Rendering
 		bool OnRender();
-		void RenderSprites();
+		// Gathers the sprites' render data once per frame, so every camera draws from the same data.
+		// Must be called before RenderSprites whenever the sprites may have changed.
+		void ExtractSprites();
+		// Only the sprites overlapping the area seen through `viewProjection` and on a layer in `cullingMask` are submitted.
+		// Tilemaps and particle emitters are culled the same way, particles are drawn last.
+		void RenderSprites(const Mat4x4& viewProjection, uint32_t cullingMask = UINT32_MAX);
+		// Rebuilds the batch holding `entity` if it's a static sprite. Needed after any change but the transform.
+		void InvalidateSprite(entt::entity entity);
 		void SetViewportSize(uint32_t width, uint32_t height);
 
 		inline PhysicsWorld2D& GetPhysicsWorld2D() { return *m_PhysicsWorld2D; }
@@ -65,6 +87,16 @@ namespace OverEngine
 		void OnCollisionExit(const Collision2D& collision);
 
 	private:
+		// Static sprites are grouped by a coarse cell, each group is drawn from a retained batch
+		struct StaticSpriteChunk
+		{
+			Vector<entt::entity> Sprites;
+			AABB2D Bounds;
+			uint32_t LayerMask = 0;
+			Renderer2D::StaticBatch Batch;
+			bool Dirty = true;
+		};
+
 		template<typename T>
 		void CopyComponentsFrom(Scene& src)
 		{
@@ -77,6 +109,21 @@ namespace OverEngine
 			});
 		}
 
+		void OnSpriteRendererConstruct(entt::registry& registry, entt::entity entity);
+		void OnSpriteRendererDestroy(entt::registry& registry, entt::entity entity);
+
+		// Called by TransformComponent the first time it changes after the last UpdateSpriteIndex, only sprites are kept
+		void OnTransformChanged(entt::entity entity);
+		void UpdateSpriteIndex();
+
+		void AddStaticSprite(entt::entity entity, const AABB2D& bounds, uint8_t layer);
+		void RemoveStaticSprite(entt::entity entity);
+		void RemoveDynamicSprite(entt::entity entity);
+		void RebuildStaticChunk(StaticSpriteChunk& chunk);
+
+		// Dynamic sprites part of RenderSprites, m_VisibleSprites must be filled
+		void SubmitVisibleSprites();
+
 	private:
 		entt::registry m_Registry;
 		PhysicsWorld2D* m_PhysicsWorld2D = nullptr;
@@ -91,7 +138,27 @@ namespace OverEngine
 		Vector<entt::entity> m_RootHandles;
 		UnorderedMap<entt::entity, Vector<entt::id_type>> m_ComponentList;
 
+		// World bounds of the dynamic sprites, kept up to date from the transform changed flags.
+		// Ordered, sprites are extracted (and drawn) by entity like the static chunks.
+		SpatialGrid2D m_SpriteIndex;
+		Map<entt::entity, SpatialGrid2D::ProxyID> m_SpriteProxies;
+		Vector<entt::entity> m_DirtySprites; // May have lost their sprite or transform since, see UpdateSpriteIndex
+
+		// Render data of the enabled dynamic sprites, the grid's user data indexes into it
+		Vector<SpriteRenderData> m_ExtractedSprites;
+		Vector<uint32_t> m_VisibleSprites;
+
+		// Static sprites by chunk, see StaticSpriteChunk
+		UnorderedMap<uint64_t, StaticSpriteChunk> m_StaticChunks;
+		Vector<const Renderer2D::StaticBatch*> m_VisibleStaticBatches; // Tilemap chunks included
+		UnorderedMap<entt::entity, uint64_t> m_StaticSpriteChunkKeys;
+
+		// Gathered by OnParticlesUpdate, kept to reuse the memory
+		Vector<ParticleEmitter2DComponent*> m_UpdatedEmitters;
+		Vector<Mat4x4> m_EmitterTransforms;
+
 		friend class Entity;
+		friend class TransformComponent;
 		friend class SceneSerializer;
 	};
 }
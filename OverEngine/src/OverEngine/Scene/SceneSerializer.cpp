@@ -4,6 +4,9 @@
 #include "Entity.h"
 #include "Components.h"
 #include "TransformComponent.h"
+#include "TilemapComponent.h"
+#include "ParticleEmitter2DComponent.h"
+#include "SpriteAnimatorComponent.h"
 #include "ComponentSerializer.h"
 
 #include "OverEngine/Core/Runtime/Serialization/ObjectSerializer.h"
@@ -73,6 +76,36 @@ namespace OverEngine
 				out << YAML::EndMap; // SpriteRendererComponent
 			}
 
+			else if (typeID == GetComponentTypeID<SpriteAnimatorComponent>())
+			{
+				out << YAML::Key << "SpriteAnimatorComponent" << YAML::BeginMap; // SpriteAnimatorComponent
+
+				auto& sa = entity.GetComponent<SpriteAnimatorComponent>();
+				ObjectSerializer<SpriteAnimatorComponent>::Serialize(out, &sa);
+
+				out << YAML::EndMap; // SpriteAnimatorComponent
+			}
+
+			else if (typeID == GetComponentTypeID<TilemapComponent>())
+			{
+				out << YAML::Key << "TilemapComponent" << YAML::BeginMap; // TilemapComponent
+
+				auto& tm = entity.GetComponent<TilemapComponent>();
+				ObjectSerializer<TilemapComponent>::Serialize(out, &tm);
+
+				out << YAML::EndMap; // TilemapComponent
+			}
+
+			else if (typeID == GetComponentTypeID<ParticleEmitter2DComponent>())
+			{
+				out << YAML::Key << "ParticleEmitter2DComponent" << YAML::BeginMap; // ParticleEmitter2DComponent
+
+				auto& pe = entity.GetComponent<ParticleEmitter2DComponent>();
+				ObjectSerializer<ParticleEmitter2DComponent>::Serialize(out, &pe);
+
+				out << YAML::EndMap; // ParticleEmitter2DComponent
+			}
+
 			else if (typeID == GetComponentTypeID<RigidBody2DComponent>())
 			{
 				out << YAML::Key << "RigidBody2DComponent" << YAML::BeginMap; // RigidBody2DComponent
@@ -174,6 +207,24 @@ namespace OverEngine
 					ObjectSerializer<SpriteRendererComponent>::Deserialize(spriteRendererComponent, &sp);
 				}
 
+				if (auto spriteAnimatorComponent = entity["SpriteAnimatorComponent"])
+				{
+					auto& sa = deserializedEntity.AddComponent<SpriteAnimatorComponent>();
+					ObjectSerializer<SpriteAnimatorComponent>::Deserialize(spriteAnimatorComponent, &sa);
+				}
+
+				if (auto tilemapComponent = entity["TilemapComponent"])
+				{
+					auto& tm = deserializedEntity.AddComponent<TilemapComponent>();
+					ObjectSerializer<TilemapComponent>::Deserialize(tilemapComponent, &tm);
+				}
+
+				if (auto particleEmitter2DComponent = entity["ParticleEmitter2DComponent"])
+				{
+					auto& pe = deserializedEntity.AddComponent<ParticleEmitter2DComponent>();
+					ObjectSerializer<ParticleEmitter2DComponent>::Deserialize(particleEmitter2DComponent, &pe);
+				}
+
 				if (auto rigidBody2DComponent = entity["RigidBody2DComponent"])
 				{
 					auto& rbc = deserializedEntity.AddComponent<RigidBody2DComponent>();
@@ -0,0 +1,105 @@
+#include "pcheader.h"
+#include "SpatialGrid2D.h"
+
+namespace OverEngine
+{
+	SpatialGrid2D::SpatialGrid2D(float cellSize)
+		: m_CellSize(cellSize)
+	{
+		OE_CORE_ASSERT(cellSize > 0.0f, "Cell size must be positive!");
+	}
+
+	SpatialGrid2D::ProxyID SpatialGrid2D::Insert(const AABB2D& bounds, uint32_t userData)
+	{
+		ProxyID proxy;
+		if (!m_FreeProxies.empty())
+		{
+			proxy = m_FreeProxies.back();
+			m_FreeProxies.pop_back();
+		}
+		else
+		{
+			proxy = (ProxyID)m_Proxies.size();
+			m_Proxies.emplace_back();
+		}
+
+		Proxy& p = m_Proxies[proxy];
+		p.Bounds = bounds;
+		p.CellKey = GetCellKey(bounds);
+		p.UserData = userData;
+
+		Link(proxy);
+		return proxy;
+	}
+
+	void SpatialGrid2D::Update(ProxyID proxy, const AABB2D& bounds)
+	{
+		Proxy& p = m_Proxies[proxy];
+		p.Bounds = bounds;
+
+		uint64_t cellKey = GetCellKey(bounds);
+		if (cellKey == p.CellKey)
+			return;
+
+		Unlink(proxy);
+		p.CellKey = cellKey;
+		Link(proxy);
+	}
+
+	void SpatialGrid2D::Remove(ProxyID proxy)
+	{
+		Unlink(proxy);
+		m_FreeProxies.push_back(proxy);
+	}
+
+	void SpatialGrid2D::Clear()
+	{
+		m_Proxies.clear();
+		m_FreeProxies.clear();
+		m_Cells.clear();
+		m_LargeProxies.clear();
+	}
+
+	uint64_t SpatialGrid2D::GetCellKey(const AABB2D& bounds) const
+	{
+		Vector2 extents = bounds.GetExtents();
+		if (extents.x > m_CellSize * 0.5f || extents.y > m_CellSize * 0.5f)
+			return LargeCellKey;
+
+		// Anything that far away (or NaN) would overflow the cell coordinates
+		Vector2 cell = glm::floor(bounds.GetCenter() / m_CellSize);
+		if (!(glm::abs(cell.x) < (float)INT32_MAX && glm::abs(cell.y) < (float)INT32_MAX))
+			return LargeCellKey;
+
+		return PackCellKey((int32_t)cell.x, (int32_t)cell.y);
+	}
+
+	Vector<SpatialGrid2D::ProxyID>& SpatialGrid2D::GetCell(uint64_t key)
+	{
+		return key == LargeCellKey ? m_LargeProxies : m_Cells[key];
+	}
+
+	void SpatialGrid2D::Link(ProxyID proxy)
+	{
+		Proxy& p = m_Proxies[proxy];
+		auto& cell = GetCell(p.CellKey);
+
+		p.IndexInCell = (uint32_t)cell.size();
+		cell.push_back(proxy);
+	}
+
+	void SpatialGrid2D::Unlink(ProxyID proxy)
+	{
+		Proxy& p = m_Proxies[proxy];
+		auto& cell = GetCell(p.CellKey);
+
+		// Swap with the last one to keep the cell packed
+		ProxyID last = cell.back();
+		cell[p.IndexInCell] = last;
+		m_Proxies[last].IndexInCell = p.IndexInCell;
+		cell.pop_back();
+
+		if (cell.empty() && p.CellKey != LargeCellKey)
+			m_Cells.erase(p.CellKey);
+	}
+}
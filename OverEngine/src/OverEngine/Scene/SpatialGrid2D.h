@@ -0,0 +1,116 @@
+#pragma once
+
+#include "OverEngine/Core/Core.h"
+#include "OverEngine/Core/Math/AABB2D.h"
+
+namespace OverEngine
+{
+	/**
+	 * Loose uniform grid of 2D bounding boxes.
+	 *
+	 * Each box is stored in the single cell containing its center, so moving
+	 * it is O(1). Cells are loose by half a cell on every side, boxes which
+	 * don't fit that are kept in a separate list that is tested on every query.
+	 * Only the non-empty cells are allocated.
+	 */
+	class SpatialGrid2D
+	{
+	public:
+		using ProxyID = uint32_t;
+		static constexpr ProxyID NullProxy = UINT32_MAX;
+
+	public:
+		SpatialGrid2D(float cellSize = 16.0f);
+
+		ProxyID Insert(const AABB2D& bounds, uint32_t userData);
+		void Update(ProxyID proxy, const AABB2D& bounds);
+		void Remove(ProxyID proxy);
+		void Clear();
+
+		inline uint32_t GetUserData(ProxyID proxy) const { return m_Proxies[proxy].UserData; }
+		inline void SetUserData(ProxyID proxy, uint32_t userData) { m_Proxies[proxy].UserData = userData; }
+		inline const AABB2D& GetBounds(ProxyID proxy) const { return m_Proxies[proxy].Bounds; }
+		inline uint32_t GetProxyCount() const { return (uint32_t)(m_Proxies.size() - m_FreeProxies.size()); }
+		inline float GetCellSize() const { return m_CellSize; }
+
+		// Calls func(uint32_t userData) for every box overlapping `area`
+		template <typename Func>
+		void Query(const AABB2D& area, Func func) const
+		{
+			auto visit = [&](const Vector<ProxyID>& proxies)
+			{
+				for (ProxyID proxy : proxies)
+				{
+					const Proxy& p = m_Proxies[proxy];
+					if (p.Bounds.Overlaps(area))
+						func(p.UserData);
+				}
+			};
+
+			visit(m_LargeProxies);
+
+			if (m_Cells.empty())
+				return;
+
+			// Boxes may hang up to half a cell out of their cell
+			float looseness = m_CellSize * 0.5f;
+			Vector2 minCell = glm::floor((area.Min - looseness) / m_CellSize);
+			Vector2 maxCell = glm::floor((area.Max + looseness) / m_CellSize);
+
+			double cellCount = ((double)maxCell.x - minCell.x + 1.0) * ((double)maxCell.y - minCell.y + 1.0);
+
+			// Huge areas touch less cells by walking the allocated ones
+			if (!(cellCount <= (double)m_Cells.size()))
+			{
+				for (const auto& [key, proxies] : m_Cells)
+				{
+					int32_t x, y;
+					UnpackCellKey(key, x, y);
+
+					if (x >= minCell.x && x <= maxCell.x && y >= minCell.y && y <= maxCell.y)
+						visit(proxies);
+				}
+				return;
+			}
+
+			for (int32_t y = (int32_t)minCell.y; y <= (int32_t)maxCell.y; y++)
+			{
+				for (int32_t x = (int32_t)minCell.x; x <= (int32_t)maxCell.x; x++)
+				{
+					auto it = m_Cells.find(PackCellKey(x, y));
+					if (it != m_Cells.end())
+						visit(it->second);
+				}
+			}
+		}
+
+	private:
+		static constexpr uint64_t LargeCellKey = UINT64_MAX;
+
+		struct Proxy
+		{
+			AABB2D Bounds;
+			uint64_t CellKey = LargeCellKey;
+			uint32_t IndexInCell = 0;
+			uint32_t UserData = 0;
+		};
+
+		inline static uint64_t PackCellKey(int32_t x, int32_t y) { return ((uint64_t)(uint32_t)x << 32) | (uint32_t)y; }
+		inline static void UnpackCellKey(uint64_t key, int32_t& x, int32_t& y) { x = (int32_t)(uint32_t)(key >> 32); y = (int32_t)(uint32_t)key; }
+
+		uint64_t GetCellKey(const AABB2D& bounds) const;
+		Vector<ProxyID>& GetCell(uint64_t key);
+
+		void Link(ProxyID proxy);
+		void Unlink(ProxyID proxy);
+
+	private:
+		float m_CellSize;
+
+		Vector<Proxy> m_Proxies;
+		Vector<ProxyID> m_FreeProxies;
+
+		UnorderedMap<uint64_t, Vector<ProxyID>> m_Cells;
+		Vector<ProxyID> m_LargeProxies;
+	};
+}
@@ -0,0 +1,71 @@
+#include "pcheader.h"
+#include "SpriteAnimatorComponent.h"
+
+#include "OverEngine/Core/Runtime/Reflection/TypeInfo.h"
+
+namespace OverEngine
+{
+	ObjectTypeInfo* SpriteAnimatorComponent::Reflect()
+	{
+		static ObjectTypeInfo* typeInfo = nullptr;
+
+		if (!typeInfo)
+		{
+			typeInfo = new ObjectTypeInfo(GetStaticClassName(), sizeof(SpriteAnimatorComponent), dynamic_cast<ObjectTypeInfo*>(TypeResolver<Component>::Get()));
+
+			ADD_PUBLIC_MEMBER_PROPERTY(SpriteAnimatorComponent, Sheet)
+			ADD_PUBLIC_MEMBER_PROPERTY(SpriteAnimatorComponent, Columns)
+			ADD_PUBLIC_MEMBER_PROPERTY(SpriteAnimatorComponent, Rows)
+			ADD_PUBLIC_MEMBER_PROPERTY(SpriteAnimatorComponent, Speed)
+			ADD_PUBLIC_MEMBER_PROPERTY(SpriteAnimatorComponent, Playing)
+		}
+
+		return typeInfo;
+	}
+
+	void SpriteAnimatorComponent::Play(uint32_t animation)
+	{
+		if (animation >= Animations.size())
+			return;
+
+		m_Animation = animation;
+		m_Time = Speed < 0.0f ? (float)Animations[animation].Frames.size() : 0.0f;
+		m_SheetFrame = UINT32_MAX;
+		Playing = true;
+	}
+
+	void SpriteAnimatorComponent::Play(const String& name)
+	{
+		for (uint32_t i = 0; i < (uint32_t)Animations.size(); i++)
+		{
+			if (Animations[i].Name == name)
+			{
+				Play(i);
+				return;
+			}
+		}
+	}
+
+	const SpriteAnimation* SpriteAnimatorComponent::GetCurrentAnimation() const
+	{
+		return m_Animation < Animations.size() ? &Animations[m_Animation] : nullptr;
+	}
+
+	bool SpriteAnimatorComponent::IsFinished() const
+	{
+		const SpriteAnimation* animation = GetCurrentAnimation();
+		if (!animation || animation->Looping)
+			return false;
+
+		return Speed < 0.0f ? m_Time <= 0.0f : m_Time >= (float)animation->Frames.size();
+	}
+
+	Rect SpriteAnimatorComponent::GetFrameRect(uint32_t sheetFrame) const
+	{
+		uint32_t columns = std::max(Columns, 1u);
+		uint32_t rows = std::max(Rows, 1u);
+		Vector2 frameSize = { 1.0f / columns, 1.0f / rows };
+
+		return { (sheetFrame % columns) * frameSize.x, (sheetFrame / columns % rows) * frameSize.y, frameSize.x, frameSize.y };
+	}
+}
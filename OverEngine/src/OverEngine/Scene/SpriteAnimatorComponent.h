@@ -0,0 +1,103 @@
+#pragma once
+
+#include "OverEngine/Core/Math/Math.h"
+#include "OverEngine/Renderer/Texture.h"
+
+#include "Components.h"
+
+namespace OverEngine
+{
+	// Frames of a SpriteAnimatorComponent's sheet, played one after the other
+	struct SpriteAnimation
+	{
+		String Name;
+		Vector<uint32_t> Frames;
+
+		float FrameRate = 12.0f; // Frames per second
+		bool Looping = true;
+	};
+
+	/**
+	 * Flipbook animation of the entity's SpriteRendererComponent.
+	 *
+	 * The sheet is cut into Columns x Rows frames, numbered from 0, left to right then top to bottom.
+	 * The Scene advances every animator in one loop and only writes the sprite's TexRect (and
+	 * Sprite, if it isn't the sheet already) when the frame changes, so animated sprites cost
+	 * nothing more to draw than still ones.
+	 */
+	struct SpriteAnimatorComponent : public Component
+	{
+		OE_CLASS_PUBLIC(SpriteAnimatorComponent, Component)
+
+		// The whole texture or a SubTexture2D of it
+		Ref<Texture2D> Sheet;
+		uint32_t Columns = 1;
+		uint32_t Rows = 1;
+
+		Vector<SpriteAnimation> Animations;
+
+		// Multiplies the frame rates, negative plays backwards
+		float Speed = 1.0f;
+		bool Playing = true;
+
+		SpriteAnimatorComponent(const SpriteAnimatorComponent&) = default;
+
+		SpriteAnimatorComponent(const Entity& entity, Ref<Texture2D> sheet = nullptr, uint32_t columns = 1, uint32_t rows = 1)
+			: Component(entity), Sheet(sheet), Columns(columns), Rows(rows) {}
+
+		// Starts the animation over, ignored if there's no such animation
+		void Play(uint32_t animation);
+		void Play(const String& name);
+
+		inline uint32_t GetAnimation() const { return m_Animation; }
+		const SpriteAnimation* GetCurrentAnimation() const;
+
+		// Frame of the sheet shown, UINT32_MAX until the first Advance
+		inline uint32_t GetSheetFrame() const { return m_SheetFrame; }
+
+		// A non looping animation reached its end
+		bool IsFinished() const;
+
+		// Normalized rect of a frame inside the sheet
+		Rect GetFrameRect(uint32_t sheetFrame) const;
+
+		// Moves the animation forward, returns true if another frame of the sheet is to be shown
+		inline bool Advance(float deltaTime)
+		{
+			if (!Playing || m_Animation >= Animations.size())
+				return false;
+
+			const SpriteAnimation& animation = Animations[m_Animation];
+			if (animation.Frames.empty())
+				return false;
+
+			// In frames
+			float frameCount = (float)animation.Frames.size();
+			m_Time += deltaTime * Speed * animation.FrameRate;
+
+			if (animation.Looping)
+			{
+				m_Time = std::fmod(m_Time, frameCount);
+				if (m_Time < 0.0f)
+					m_Time += frameCount;
+			}
+			else
+			{
+				m_Time = std::min(std::max(m_Time, 0.0f), frameCount);
+			}
+
+			uint32_t frame = std::min((uint32_t)m_Time, (uint32_t)animation.Frames.size() - 1);
+			uint32_t sheetFrame = animation.Frames[frame];
+			if (sheetFrame == m_SheetFrame)
+				return false;
+
+			m_SheetFrame = sheetFrame;
+			return true;
+		}
+
+	private:
+		uint32_t m_Animation = 0;
+		float m_Time = 0.0f; // In frames since the start of the animation
+		uint32_t m_SheetFrame = UINT32_MAX;
+	};
+}
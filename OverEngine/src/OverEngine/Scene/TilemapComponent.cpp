@@ -0,0 +1,286 @@
+#include "pcheader.h"
+#include "TilemapComponent.h"
+
+#include "OverEngine/Core/Runtime/Reflection/TypeInfo.h"
+
+namespace OverEngine
+{
+	ObjectTypeInfo* TilemapComponent::Reflect()
+	{
+		static ObjectTypeInfo* typeInfo = nullptr;
+
+		if (!typeInfo)
+		{
+			typeInfo = new ObjectTypeInfo(GetStaticClassName(), sizeof(TilemapComponent), dynamic_cast<ObjectTypeInfo*>(TypeResolver<Component>::Get()));
+
+			ADD_PUBLIC_MEMBER_PROPERTY(TilemapComponent, TileSet)
+			ADD_PUBLIC_MEMBER_PROPERTY(TilemapComponent, Columns)
+			ADD_PUBLIC_MEMBER_PROPERTY(TilemapComponent, Rows)
+			ADD_PUBLIC_MEMBER_PROPERTY(TilemapComponent, CellSize)
+			ADD_PUBLIC_MEMBER_PROPERTY(TilemapComponent, Tint)
+			ADD_PUBLIC_MEMBER_PROPERTY(TilemapComponent, Layer)
+		}
+
+		return typeInfo;
+	}
+
+	// Rounds towards negative infinity, so cell -1 is in chunk -1
+	static inline int32_t FloorDiv(int32_t value, int32_t divisor)
+	{
+		return value >= 0 ? value / divisor : (value - divisor + 1) / divisor;
+	}
+
+	uint64_t TilemapComponent::GetChunkKey(int32_t chunkX, int32_t chunkY)
+	{
+		return ((uint64_t)(uint32_t)chunkX << 32) | (uint64_t)(uint32_t)chunkY;
+	}
+
+	Vec2T<int32_t> TilemapComponent::GetChunkCoords(uint64_t key)
+	{
+		return { (int32_t)(uint32_t)(key >> 32), (int32_t)(uint32_t)(key & UINT32_MAX) };
+	}
+
+	uint16_t TilemapComponent::GetTile(int32_t x, int32_t y) const
+	{
+		int32_t chunkX = FloorDiv(x, ChunkSize);
+		int32_t chunkY = FloorDiv(y, ChunkSize);
+
+		auto it = m_Chunks.find(GetChunkKey(chunkX, chunkY));
+		if (it == m_Chunks.end())
+			return EmptyTile;
+
+		return it->second.Tiles[(y - chunkY * ChunkSize) * ChunkSize + (x - chunkX * ChunkSize)];
+	}
+
+	void TilemapComponent::SetTile(int32_t x, int32_t y, uint16_t tile)
+	{
+		int32_t chunkX = FloorDiv(x, ChunkSize);
+		int32_t chunkY = FloorDiv(y, ChunkSize);
+		uint64_t key = GetChunkKey(chunkX, chunkY);
+
+		auto it = m_Chunks.find(key);
+		if (it == m_Chunks.end())
+		{
+			if (tile == EmptyTile)
+				return;
+
+			it = m_Chunks.try_emplace(key).first;
+		}
+
+		Chunk& chunk = it->second;
+		uint16_t& cell = chunk.Tiles[(y - chunkY * ChunkSize) * ChunkSize + (x - chunkX * ChunkSize)];
+		if (cell == tile)
+			return;
+
+		if (cell == EmptyTile)
+			chunk.TileCount++;
+		else if (tile == EmptyTile)
+			chunk.TileCount--;
+
+		cell = tile;
+
+		if (chunk.TileCount == 0)
+			m_Chunks.erase(it);
+		else
+			chunk.Dirty = true;
+	}
+
+	void TilemapComponent::Clear()
+	{
+		m_Chunks.clear();
+	}
+
+	void TilemapComponent::Invalidate()
+	{
+		for (auto& [key, chunk] : m_Chunks)
+			chunk.Dirty = true;
+	}
+
+	Vec2T<int32_t> TilemapComponent::WorldToCell(const Mat4x4& localToWorld, const Vector2& worldPosition) const
+	{
+		Vector2 local = glm::inverse(localToWorld) * Vector4(worldPosition, 0.0f, 1.0f);
+		Vector2 cell = glm::floor(local / CellSize);
+		return { (int32_t)cell.x, (int32_t)cell.y };
+	}
+
+	void TilemapComponent::UpdateChunks(const Mat4x4& localToWorld)
+	{
+		if (localToWorld != m_BuiltTransform)
+		{
+			m_BuiltTransform = localToWorld;
+			Invalidate();
+		}
+
+		for (auto& [key, chunk] : m_Chunks)
+		{
+			if (chunk.Dirty)
+			{
+				auto coords = GetChunkCoords(key);
+				BuildChunk(chunk, coords.x, coords.y);
+			}
+		}
+	}
+
+	void TilemapComponent::BuildChunk(Chunk& chunk, int32_t chunkX, int32_t chunkY)
+	{
+		OE_PROFILE_FUNCTION();
+
+		chunk.Dirty = false;
+
+		const Mat4x4& transform = m_BuiltTransform;
+		Vector2 axisX = transform[0];
+		Vector2 axisY = transform[1];
+
+		// Chunk area in world space
+		Vector2 origin = Vector2(chunkX, chunkY) * CellSize * (float)ChunkSize;
+		Vector2 extent = CellSize * (float)ChunkSize;
+
+		chunk.Bounds = { Vector2(std::numeric_limits<float>::max()), Vector2(std::numeric_limits<float>::lowest()) };
+		for (int i = 0; i < 4; i++)
+		{
+			Vector2 corner = transform * Vector4(origin + extent * Vector2(i & 1, i >> 1), 0.0f, 1.0f);
+			chunk.Bounds.Min = glm::min(chunk.Bounds.Min, corner);
+			chunk.Bounds.Max = glm::max(chunk.Bounds.Max, corner);
+		}
+
+		// Quads only have a rotation and a size, shearing is lost.
+		// A mirrored transform gives a negative height.
+		float scaleX = glm::length(axisX);
+		if (scaleX == 0.0f || Columns == 0 || Rows == 0)
+		{
+			chunk.Batch.Clear();
+			return;
+		}
+
+		float scaleY = (axisX.x * axisY.y - axisX.y * axisY.x) / scaleX;
+		float rotation = std::atan2(axisX.y, axisX.x);
+		Vector2 size = CellSize * Vector2(scaleX, scaleY);
+		Vector2 tileSize = { 1.0f / Columns, 1.0f / Rows };
+		uint32_t tileCount = GetTileCount();
+
+		Vector<QuadInstance> instances;
+		instances.reserve(chunk.TileCount);
+
+		for (int32_t y = 0; y < ChunkSize; y++)
+		{
+			for (int32_t x = 0; x < ChunkSize; x++)
+			{
+				uint16_t tile = chunk.Tiles[y * ChunkSize + x];
+				if (tile == EmptyTile || tile > tileCount)
+					continue;
+
+				uint32_t index = tile - 1;
+				Vector2 center = origin + (Vector2(x, y) + 0.5f) * CellSize;
+
+				QuadInstance& instance = instances.emplace_back();
+				instance.Position = transform * Vector4(center, 0.0f, 1.0f);
+				instance.Rotation = rotation;
+				instance.Size = size;
+				instance.TexRect = { (index % Columns) * tileSize.x, (index / Columns) * tileSize.y, tileSize.x, tileSize.y };
+			}
+		}
+
+		TexturedQuadProps props;
+		props.Tint = Tint;
+		props.Sprite = TileSet;
+
+		Renderer2D::SubmissionContext context;
+		context.DrawQuads(instances, props);
+		chunk.Batch.Build(context);
+	}
+
+	////////////////////////////////////////////////////////
+	/// Serialization //////////////////////////////////////
+	////////////////////////////////////////////////////////
+
+	/**
+	 * Little endian, starting with two uint32s:
+	 *   Version (TilesVersion) and ChunkCount
+	 *
+	 * Then for each chunk:
+	 *   int32 X, int32 Y                   Chunk coordinates
+	 *   uint16 Tiles[ChunkSize*ChunkSize]  Bottom row first
+	 */
+	static constexpr uint32_t TilesVersion = 1;
+	static constexpr size_t ChunkBlobSize = 8 + TilemapComponent::ChunkSize * TilemapComponent::ChunkSize * 2;
+
+	static inline void WriteUInt32(uint8_t* dst, uint32_t value)
+	{
+		dst[0] = (uint8_t)(value);
+		dst[1] = (uint8_t)(value >> 8);
+		dst[2] = (uint8_t)(value >> 16);
+		dst[3] = (uint8_t)(value >> 24);
+	}
+
+	static inline uint32_t ReadUInt32(const uint8_t* src)
+	{
+		return (uint32_t)src[0] | ((uint32_t)src[1] << 8) | ((uint32_t)src[2] << 16) | ((uint32_t)src[3] << 24);
+	}
+
+	Vector<uint8_t> TilemapComponent::SaveTiles() const
+	{
+		// Sorted so saving the same map twice gives the same bytes
+		Vector<uint64_t> keys;
+		keys.reserve(m_Chunks.size());
+		for (const auto& [key, chunk] : m_Chunks)
+			keys.push_back(key);
+		std::sort(keys.begin(), keys.end());
+
+		Vector<uint8_t> data(8 + keys.size() * ChunkBlobSize);
+		WriteUInt32(&data[0], TilesVersion);
+		WriteUInt32(&data[4], (uint32_t)keys.size());
+
+		uint8_t* ptr = data.data() + 8;
+		for (uint64_t key : keys)
+		{
+			auto coords = GetChunkCoords(key);
+			WriteUInt32(ptr, (uint32_t)coords.x);
+			WriteUInt32(ptr + 4, (uint32_t)coords.y);
+			ptr += 8;
+
+			for (uint16_t tile : m_Chunks.at(key).Tiles)
+			{
+				ptr[0] = (uint8_t)(tile);
+				ptr[1] = (uint8_t)(tile >> 8);
+				ptr += 2;
+			}
+		}
+
+		return data;
+	}
+
+	bool TilemapComponent::LoadTiles(const uint8_t* data, size_t size)
+	{
+		if (size < 8 || ReadUInt32(data) != TilesVersion)
+			return false;
+
+		uint32_t chunkCount = ReadUInt32(data + 4);
+		if (size != 8 + chunkCount * ChunkBlobSize)
+			return false;
+
+		m_Chunks.clear();
+
+		const uint8_t* ptr = data + 8;
+		for (uint32_t i = 0; i < chunkCount; i++)
+		{
+			int32_t chunkX = (int32_t)ReadUInt32(ptr);
+			int32_t chunkY = (int32_t)ReadUInt32(ptr + 4);
+			ptr += 8;
+
+			Chunk& chunk = m_Chunks[GetChunkKey(chunkX, chunkY)];
+			chunk.TileCount = 0;
+			for (uint16_t& tile : chunk.Tiles)
+			{
+				tile = (uint16_t)(ptr[0] | (ptr[1] << 8));
+				if (tile != EmptyTile)
+					chunk.TileCount++;
+				ptr += 2;
+			}
+
+			if (chunk.TileCount == 0)
+				m_Chunks.erase(GetChunkKey(chunkX, chunkY));
+		}
+
+		return true;
+	}
+}
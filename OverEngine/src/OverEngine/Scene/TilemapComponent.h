@@ -0,0 +1,108 @@
+#pragma once
+
+#include "OverEngine/Core/Math/Math.h"
+#include "OverEngine/Core/Math/AABB2D.h"
+#include "OverEngine/Renderer/Renderer2D.h"
+
+#include "Components.h"
+
+#include <array>
+
+namespace OverEngine
+{
+	/**
+	 * Grid of tiles taken from a tile set texture, stored in dense square chunks.
+	 * Each chunk is baked into its own StaticBatch, culled as a whole and only
+	 * rebuilt after one of its tiles changes.
+	 *
+	 * Tiles are numbered from 1, left to right then top to bottom in the tile set.
+	 * 0 is an empty cell. Cell (0, 0) has its bottom left corner at the entity's origin.
+	 */
+	struct TilemapComponent : public Component
+	{
+		OE_CLASS_PUBLIC(TilemapComponent, Component)
+
+		static constexpr int32_t ChunkSize = 32;
+		static constexpr uint16_t EmptyTile = 0;
+
+		struct Chunk
+		{
+			std::array<uint16_t, ChunkSize * ChunkSize> Tiles;
+			uint32_t TileCount = 0;
+
+			// Built by the Scene, in world space
+			Renderer2D::StaticBatch Batch;
+			AABB2D Bounds;
+			bool Dirty = true;
+
+			Chunk() { Tiles.fill(EmptyTile); }
+
+			// Batches are not shared, copies are rebuilt
+			Chunk(const Chunk& other)
+				: Tiles(other.Tiles), TileCount(other.TileCount) {}
+
+			Chunk& operator=(const Chunk& other)
+			{
+				Tiles = other.Tiles;
+				TileCount = other.TileCount;
+				Batch.Clear();
+				Dirty = true;
+				return *this;
+			}
+
+			Chunk(Chunk&& other) noexcept = default;
+			Chunk& operator=(Chunk&& other) noexcept = default;
+		};
+
+		// Cut into Columns x Rows tiles
+		Ref<Texture2D> TileSet;
+		uint32_t Columns = 1;
+		uint32_t Rows = 1;
+
+		Vector2 CellSize = Vector2(1.0f);
+		Color Tint = Color(1.0f);
+
+		// Less than RenderLayerCount, see CameraComponent::CullingMask
+		uint8_t Layer = 0;
+
+		TilemapComponent(const TilemapComponent&) = default;
+
+		TilemapComponent(const Entity& entity, Ref<Texture2D> tileSet = nullptr, uint32_t columns = 1, uint32_t rows = 1)
+			: Component(entity), TileSet(tileSet), Columns(columns), Rows(rows) {}
+
+		uint16_t GetTile(int32_t x, int32_t y) const;
+
+		// Creates the chunk holding the cell if needed, chunks left empty are removed
+		void SetTile(int32_t x, int32_t y, uint16_t tile);
+
+		void Clear();
+
+		// Rebuilds every chunk, needed after changing anything but the tiles and the transform
+		void Invalidate();
+
+		// Cell under `worldPosition`, given the entity's transform
+		Vec2T<int32_t> WorldToCell(const Mat4x4& localToWorld, const Vector2& worldPosition) const;
+
+		inline uint32_t GetTileCount() const { return Columns * Rows; }
+		inline const UnorderedMap<uint64_t, Chunk>& GetChunks() const { return m_Chunks; }
+
+		// Rebuilds the dirty chunks, or all of them if `localToWorld` changed. Called by the Scene.
+		void UpdateChunks(const Mat4x4& localToWorld);
+
+		// Every tile as a blob, see the .cpp for the layout
+		Vector<uint8_t> SaveTiles() const;
+		bool LoadTiles(const uint8_t* data, size_t size);
+
+	private:
+		static uint64_t GetChunkKey(int32_t chunkX, int32_t chunkY);
+		static Vec2T<int32_t> GetChunkCoords(uint64_t key);
+
+		void BuildChunk(Chunk& chunk, int32_t chunkX, int32_t chunkY);
+
+	private:
+		UnorderedMap<uint64_t, Chunk> m_Chunks;
+
+		// Transform the chunks are built with
+		Mat4x4 m_BuiltTransform = Mat4x4(0.0f);
+	};
+}
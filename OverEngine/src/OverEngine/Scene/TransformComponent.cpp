@@ -241,6 +241,9 @@ namespace OverEngine
 	// Add changed flag and force all children to update
 	void TransformComponent::Change()
 	{
+		if (!(m_ChangedFlags & ChangedFlags_Changed))
+			AttachedEntity.GetScene()->OnTransformChanged(AttachedEntity.GetRuntimeID());
+
 		m_ChangedFlags |= ChangedFlags_Changed | ChangedFlags_ChangedForPhysics;
 		Invalidate();
 
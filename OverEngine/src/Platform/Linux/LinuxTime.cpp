@@ -2,20 +2,23 @@
 
 #include "LinuxTime.h"
 
-#include <GLFW/glfw3.h>
+#include <chrono>
 
 namespace OverEngine
 {
+	// Not glfwGetTime, which needs GLFW to be initialized (headless applications never do)
+	static const std::chrono::steady_clock::time_point s_StartTime = std::chrono::steady_clock::now();
+
 	Time* Time::s_Instance = new LinuxTime();
 
 	float LinuxTime::GetTimeImpl()
 	{
-		return (float)glfwGetTime();
+		return (float)GetTimeDoubleImpl();
 	}
 
 	double LinuxTime::GetTimeDoubleImpl()
 	{
-		return glfwGetTime();
+		return std::chrono::duration<double>(std::chrono::steady_clock::now() - s_StartTime).count();
 	}
 
 }
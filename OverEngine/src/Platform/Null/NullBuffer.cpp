@@ -0,0 +1,111 @@
+#include "pcheader.h"
+#include "NullBuffer.h"
+
+namespace OverEngine
+{
+	/////////////////////////////////////////////////////////////////////////////
+	// VertexBuffer /////////////////////////////////////////////////////////////
+	/////////////////////////////////////////////////////////////////////////////
+
+	NullVertexBuffer::NullVertexBuffer(const void* vertices, uint32_t size, bool staticDraw)
+		: m_Size(size)
+	{
+	}
+
+	void NullVertexBuffer::BufferSubData(const void* vertices, uint32_t size, uint32_t offset) const
+	{
+		OE_CORE_ASSERT(offset + size <= m_Size, "Out of bounds VertexBuffer write!");
+	}
+
+	/////////////////////////////////////////////////////////////////////////////
+	// StreamingVertexBuffer ////////////////////////////////////////////////////
+	/////////////////////////////////////////////////////////////////////////////
+
+	NullStreamingVertexBuffer::NullStreamingVertexBuffer(uint32_t segmentSize, uint32_t segmentCount)
+		: m_SegmentSize(segmentSize), m_SegmentCount(segmentCount)
+	{
+		OE_CORE_ASSERT(segmentSize > 0 && segmentCount > 0, "Invalid StreamingVertexBuffer size!");
+		m_Data = CreateScope<uint8_t[]>((size_t)segmentSize * segmentCount);
+	}
+
+	void NullStreamingVertexBuffer::BufferData(const void* vertices, uint32_t size, bool staticDraw) const
+	{
+		OE_CORE_ASSERT(false, "Can't BufferData into a StreamingVertexBuffer, use Reserve & Commit!");
+	}
+
+	void NullStreamingVertexBuffer::BufferSubData(const void* vertices, uint32_t size, uint32_t offset) const
+	{
+		OE_CORE_ASSERT(offset + size <= m_SegmentSize * m_SegmentCount, "Out of bounds StreamingVertexBuffer write!");
+		memcpy(m_Data.get() + offset, vertices, size);
+	}
+
+	void NullStreamingVertexBuffer::AllocateStorage(uint32_t size) const
+	{
+		OE_CORE_ASSERT(false, "StreamingVertexBuffer has immutable storage!");
+	}
+
+	// Same bookkeeping as the OpenGL one minus the fences, so offsets and capacities match
+	void* NullStreamingVertexBuffer::Reserve(uint32_t minSize, uint32_t& available)
+	{
+		OE_CORE_ASSERT(minSize <= m_SegmentSize, "Requested size is bigger than a StreamingVertexBuffer segment!");
+
+		if (uint32_t stride = m_Layout.GetStride())
+			m_Head = (m_Head + stride - 1) / stride * stride;
+
+		uint32_t segmentEnd = (m_CurrentSegment + 1) * m_SegmentSize;
+		if (m_Head + minSize > segmentEnd)
+		{
+			NextSegment();
+			segmentEnd = m_Head + m_SegmentSize;
+		}
+
+		available = segmentEnd - m_Head;
+		return m_Data.get() + m_Head;
+	}
+
+	uint32_t NullStreamingVertexBuffer::Commit(uint32_t size)
+	{
+		OE_CORE_ASSERT(m_Head + size <= (m_CurrentSegment + 1) * m_SegmentSize, "StreamingVertexBuffer segment overflow!");
+
+		uint32_t offset = m_Head;
+		m_Head += size;
+		return offset;
+	}
+
+	void NullStreamingVertexBuffer::NextFrame()
+	{
+		if (m_Head == m_CurrentSegment * m_SegmentSize)
+			return;
+
+		NextSegment();
+	}
+
+	void NullStreamingVertexBuffer::NextSegment()
+	{
+		m_CurrentSegment = (m_CurrentSegment + 1) % m_SegmentCount;
+		m_Head = m_CurrentSegment * m_SegmentSize;
+	}
+
+	/////////////////////////////////////////////////////////////////////////////
+	// IndexBuffer //////////////////////////////////////////////////////////////
+	/////////////////////////////////////////////////////////////////////////////
+
+	NullIndexBuffer::NullIndexBuffer(const uint32_t* indices, uint32_t count, bool staticDraw)
+		: m_Count(count)
+	{
+	}
+
+	void NullIndexBuffer::BufferSubData(const uint32_t* indices, uint32_t count, uint32_t offset) const
+	{
+		OE_CORE_ASSERT(offset + count <= m_Count, "Out of bounds IndexBuffer write!");
+	}
+
+	/////////////////////////////////////////////////////////////////////////////
+	// StorageBuffer ////////////////////////////////////////////////////////////
+	/////////////////////////////////////////////////////////////////////////////
+
+	void NullStorageBuffer::SetData(const void* data, uint32_t size, uint32_t offset)
+	{
+		OE_CORE_ASSERT(offset + size <= m_Size, "Out of bounds StorageBuffer write!");
+	}
+}
@@ -0,0 +1,96 @@
+#pragma once
+
+#include "OverEngine/Renderer/Buffer.h"
+
+namespace OverEngine
+{
+	// Only keeps the sizes and layout, uploads are dropped
+	class NullVertexBuffer : public VertexBuffer
+	{
+	public:
+		NullVertexBuffer() = default;
+		NullVertexBuffer(const void* vertices, uint32_t size, bool staticDraw);
+
+		virtual void Bind() const override {}
+		virtual void Unbind() const override {}
+
+		virtual void BufferData(const void* vertices, uint32_t size, bool staticDraw = true) const override { m_Size = size; }
+		virtual void BufferSubData(const void* vertices, uint32_t size, uint32_t offset = 0) const override;
+		virtual void AllocateStorage(uint32_t size) const override { m_Size = size; }
+
+		virtual const BufferLayout& GetLayout() const override { return m_Layout; }
+		virtual void SetLayout(const BufferLayout& layout) override { m_Layout = layout; }
+	private:
+		mutable uint32_t m_Size = 0;
+		BufferLayout m_Layout;
+	};
+
+	// Backed by plain memory so the renderers can write into it as usual
+	class NullStreamingVertexBuffer : public StreamingVertexBuffer
+	{
+	public:
+		NullStreamingVertexBuffer(uint32_t segmentSize, uint32_t segmentCount);
+
+		virtual void Bind() const override {}
+		virtual void Unbind() const override {}
+
+		virtual void BufferData(const void* vertices, uint32_t size, bool staticDraw = true) const override;
+		virtual void BufferSubData(const void* vertices, uint32_t size, uint32_t offset = 0) const override;
+		virtual void AllocateStorage(uint32_t size) const override;
+
+		virtual const BufferLayout& GetLayout() const override { return m_Layout; }
+		virtual void SetLayout(const BufferLayout& layout) override { m_Layout = layout; }
+
+		virtual void* Reserve(uint32_t minSize, uint32_t& available) override;
+		virtual uint32_t Commit(uint32_t size) override;
+		virtual void NextFrame() override;
+
+		virtual uint32_t GetSegmentSize() const override { return m_SegmentSize; }
+		virtual uint32_t GetSegmentCount() const override { return m_SegmentCount; }
+	private:
+		void NextSegment();
+	private:
+		BufferLayout m_Layout;
+
+		Scope<uint8_t[]> m_Data;
+		uint32_t m_SegmentSize;
+		uint32_t m_SegmentCount;
+
+		uint32_t m_CurrentSegment = 0;
+		uint32_t m_Head = 0;
+	};
+
+	class NullIndexBuffer : public IndexBuffer
+	{
+	public:
+		NullIndexBuffer() = default;
+		NullIndexBuffer(const uint32_t* indices, uint32_t count, bool staticDraw);
+
+		virtual void Bind() const override {}
+		virtual void Unbind() const override {}
+
+		virtual void BufferData(const uint32_t* indices, uint32_t count, bool staticDraw = true) const override { m_Count = count; }
+		virtual void BufferSubData(const uint32_t* indices, uint32_t count, uint32_t offset = 0) const override;
+		virtual void AllocateStorage(uint32_t count) const override { m_Count = count; }
+
+		virtual uint32_t GetCount() const override { return m_Count; }
+	private:
+		mutable uint32_t m_Count = 0;
+	};
+
+	class NullStorageBuffer : public StorageBuffer
+	{
+	public:
+		NullStorageBuffer(uint32_t size, const void* data)
+			: m_Size(size) {}
+
+		virtual void Bind(uint32_t binding) const override {}
+
+		virtual void SetData(const void* data, uint32_t size, uint32_t offset = 0) override;
+
+		virtual uint32_t GetSize() const override { return m_Size; }
+		virtual uint32_t GetRendererID() const override { return 0; }
+	private:
+		uint32_t m_Size;
+	};
+}
@@ -0,0 +1,20 @@
+#pragma once
+
+#include "OverEngine/Renderer/GraphicsContext.h"
+
+namespace OverEngine
+{
+	class NullContext : public GraphicsContext
+	{
+	public:
+		virtual void Init() override {}
+		virtual void SwapBuffers() override {}
+
+		virtual void Current() override {}
+		virtual void Release() override {}
+
+		virtual const char* GetInfoVersion() override { return "None"; }
+		virtual const char* GetInfoVendor() override { return "None"; }
+		virtual const char* GetInfoRenderer() override { return "Null Renderer"; }
+	};
+}
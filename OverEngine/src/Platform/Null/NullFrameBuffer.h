@@ -0,0 +1,28 @@
+#pragma once
+
+#include "OverEngine/Renderer/FrameBuffer.h"
+
+namespace OverEngine
+{
+	class NullFrameBuffer : public FrameBuffer
+	{
+	public:
+		NullFrameBuffer(const FrameBufferProps& props)
+			: m_Props(props) {}
+
+		virtual void Bind() override {}
+		virtual void Unbind() override {}
+
+		virtual void Resize(uint32_t width, uint32_t height) override
+		{
+			m_Props.Width = width;
+			m_Props.Height = height;
+		}
+
+		virtual uint32_t GetColorAttachmentRendererID() const override { return 0; }
+
+		virtual const FrameBufferProps& GetProps() const override { return m_Props; }
+	private:
+		FrameBufferProps m_Props;
+	};
+}
@@ -0,0 +1,42 @@
+#pragma once
+
+#include "OverEngine/Renderer/RendererAPI.h"
+
+namespace OverEngine
+{
+	// Draws nothing, keeps the state queries consistent with what was set
+	class NullRendererAPI : public RendererAPI
+	{
+	public:
+		virtual void Init() override {}
+
+		virtual void SetViewport(uint32_t x, uint32_t y, uint32_t width, uint32_t height) override {}
+		virtual void SetClearColor(const Math::Color& color) override {}
+		virtual void SetClearDepth(float depth) override {}
+		virtual void Clear(const ClearFlags& flags) override {}
+
+		virtual void DrawIndexed(const Ref<VertexArray>& vertexArray, uint32_t indexCount = 0, DrawType drawType = DrawType::Triangles) override {}
+		virtual void DrawArrays(const Ref<VertexArray>& vertexArray, uint32_t first, uint32_t count, DrawType drawType = DrawType::Triangles) override {}
+		virtual void DrawInstanced(const Ref<VertexArray>& vertexArray, uint32_t vertexCount, uint32_t instanceCount, uint32_t baseInstance = 0, DrawType drawType = DrawType::Triangles) override {}
+		virtual void DrawIndirect(const Ref<VertexArray>& vertexArray, const Ref<StorageBuffer>& commands, uint32_t offset = 0, DrawType drawType = DrawType::Triangles) override {}
+
+		virtual void DispatchCompute(uint32_t groupCountX, uint32_t groupCountY = 1, uint32_t groupCountZ = 1) override {}
+		virtual void Barrier(BarrierFlags flags) override {}
+
+		// Common desktop limits, so batches break where they would on a GPU
+		virtual uint32_t GetMaxTextureSize() override { return 16384; }
+		virtual uint32_t GetMaxTextureSlotCount() override { return 32; }
+
+		virtual bool IsDepthTestingEnabled() override { return m_DepthTesting; }
+		virtual void DisableDepthTesting() override { m_DepthTesting = false; }
+		virtual void EnableDepthTesting() override { m_DepthTesting = true; }
+
+		virtual void DisableDepthWriting() override {}
+		virtual void EnableDepthWriting() override {}
+
+		virtual void DisableBlending() override {}
+		virtual void EnableBlending() override {}
+	private:
+		bool m_DepthTesting = true; // Like the OpenGL backend after Init
+	};
+}
@@ -0,0 +1,15 @@
+#include "pcheader.h"
+#include "NullShader.h"
+
+namespace OverEngine
+{
+	NullShader::NullShader(const String& filePath)
+		: m_FilePath(filePath)
+	{
+		auto lastSlash = filePath.find_last_of("/\\");
+		lastSlash = lastSlash == String::npos ? 0 : lastSlash + 1;
+		auto lastDot = filePath.rfind('.');
+		auto count = lastDot == String::npos ? filePath.size() - lastSlash : lastDot - lastSlash;
+		m_Name = filePath.substr(lastSlash, count);
+	}
+}
@@ -0,0 +1,40 @@
+#pragma once
+
+#include "OverEngine/Renderer/Shader.h"
+
+namespace OverEngine
+{
+	// Nothing is compiled, only the name is kept
+	class NullShader : public Shader
+	{
+	public:
+		NullShader(const String& filePath);
+		NullShader(const String& name, const String& vertexSrc, const String& fragmentSrc)
+			: m_Name(name) {}
+		NullShader(const String& name, const char* vertexSrc, const char* fragmentSrc)
+			: m_Name(name) {}
+
+		virtual void Bind() const override {}
+		virtual void Unbind() const override {}
+
+		virtual const String& GetName() const override { return m_Name; }
+
+		virtual void UploadUniformInt(const char* name, int value) override {}
+		virtual void UploadUniformIntArray(const char* name, const int* value, int count) override {}
+
+		virtual void UploadUniformFloat(const char* name, float value) override {}
+		virtual void UploadUniformFloat2(const char* name, const Vector2& value) override {}
+		virtual void UploadUniformFloat3(const char* name, const Vector3& value) override {}
+		virtual void UploadUniformFloat4(const char* name, const Vector4& value) override {}
+
+		virtual void UploadUniformMat3(const char* name, const Mat3x3& matrix) override {}
+		virtual void UploadUniformMat4(const char* name, const Mat4x4& matrix) override {}
+
+		virtual bool Reload(const String& filePath = String()) override { return !filePath.empty() || !m_FilePath.empty(); }
+		virtual bool Reload(const String& vertexSrc, const String& fragmentSrc) override { return true; }
+		virtual bool Reload(const char* vertexSrc, const char* fragmentSrc) override { return true; }
+	private:
+		String m_Name;
+		String m_FilePath;
+	};
+}
@@ -0,0 +1,93 @@
+#include "pcheader.h"
+#include "NullTexture.h"
+
+#include <stb_image.h>
+
+namespace OverEngine
+{
+	static TextureFormat GetFormatFromChannelCount(int channels)
+	{
+		switch (channels)
+		{
+		case 3: return TextureFormat::RGB8;
+		case 4: return TextureFormat::RGBA8;
+
+		default: return TextureFormat::None;
+		}
+	}
+
+	NullTexture2D::NullTexture2D(const String& path)
+	{
+		// Decoded anyway, opacity depends on the pixels
+		int width, height, channels;
+		stbi_uc* data = stbi_load(path.c_str(), &width, &height, &channels, 0);
+		OE_CORE_ASSERT(data, "Failed to load image at path '{}'! reason: '{}'", path, stbi_failure_reason());
+
+		m_Format = GetFormatFromChannelCount(channels);
+		OE_CORE_ASSERT(m_Format != TextureFormat::None, "Unsupported image format (channel count = {}).", channels);
+
+		m_Width = width;
+		m_Height = height;
+		m_Filter = TextureFilter::BiLinear;
+		m_Wrap = { TextureWrap::Repeat, TextureWrap::Repeat };
+
+		SetPixels(data);
+		stbi_image_free(data);
+	}
+
+	NullTexture2D::NullTexture2D(const uint64_t& guid)
+	{
+		SetGuid(guid);
+	}
+
+	NullTexture2D::NullTexture2D(uint32_t width, uint32_t height, TextureFormat format, const void* data)
+		: m_Width(width), m_Height(height), m_Format(format)
+	{
+		OE_CORE_ASSERT(m_Format != TextureFormat::None, "Unsupported texture format!");
+
+		m_Filter = TextureFilter::BiLinear;
+		m_Wrap = { TextureWrap::Repeat, TextureWrap::Repeat };
+
+		SetPixels(data);
+	}
+
+	void NullTexture2D::SetPixels(const void* data)
+	{
+		m_Loaded = true;
+
+		m_Opaque = m_Format == TextureFormat::RGB8;
+		if (data && m_Format == TextureFormat::RGBA8)
+		{
+			const uint8_t* pixels = static_cast<const uint8_t*>(data);
+			size_t size = (size_t)m_Width * m_Height * 4;
+
+			m_Opaque = true;
+			for (size_t i = 3; i < size && m_Opaque; i += 4)
+				m_Opaque = pixels[i] == 0xFF;
+		}
+	}
+
+	void NullTexture2D::Acquire(Ref<Asset> other)
+	{
+		if (auto otherNullTexture = std::dynamic_pointer_cast<NullTexture2D>(other))
+		{
+			m_Loaded = otherNullTexture->m_Loaded;
+			m_Width  = otherNullTexture->m_Width;
+			m_Height = otherNullTexture->m_Height;
+			m_Format = otherNullTexture->m_Format;
+			m_Filter = otherNullTexture->m_Filter;
+			m_Wrap   = otherNullTexture->m_Wrap;
+			m_Opaque = otherNullTexture->m_Opaque;
+			m_Generation++;
+
+			otherNullTexture->m_Loaded = false;
+		}
+	}
+
+	void NullTexture2DArray::CopyToLayer(const Ref<Texture2D>& texture, uint32_t layer)
+	{
+		OE_CORE_ASSERT(layer < m_LayerCount, "Texture2DArray layer out of range!");
+		OE_CORE_ASSERT(texture->GetWidth() == m_Width && texture->GetHeight() == m_Height && texture->GetFormat() == m_Format,
+			"Texture doesn't match the Texture2DArray!");
+	}
+}
@@ -0,0 +1,76 @@
+#pragma once
+
+#include "OverEngine/Core/Core.h"
+#include "OverEngine/Renderer/Texture.h"
+
+namespace OverEngine
+{
+	// Has the metadata of the image it's created from, without the pixels
+	class NullTexture2D : public Texture2D
+	{
+	public:
+		NullTexture2D(const String& path);
+		NullTexture2D(const uint64_t& guid);
+		NullTexture2D(uint32_t width, uint32_t height, TextureFormat format, const void* data);
+		virtual void Acquire(Ref<Asset> other) override;
+
+		virtual uint32_t GetWidth() const override { return m_Width; }
+		virtual uint32_t GetHeight() const override { return m_Height; }
+		virtual uint32_t GetRendererID() const override { return 0; }
+
+		virtual void Bind(uint32_t slot = 0) override {}
+
+		// Filter
+		virtual TextureFilter GetFilter() const override { return m_Filter; }
+		virtual void SetFilter(TextureFilter filter) override { m_Filter = filter; }
+
+		// Wrap
+		virtual TextureWrap GetUWrap() const override { return m_Wrap.u; }
+		virtual void SetUWrap(TextureWrap wrap) override { m_Wrap.u = wrap; }
+
+		virtual TextureWrap GetVWrap() const override { return m_Wrap.v; }
+		virtual void SetVWrap(TextureWrap wrap) override { m_Wrap.v = wrap; }
+
+		// Other
+		virtual TextureFormat GetFormat() const override { return m_Format; }
+		virtual TextureType GetType() const override { return TextureType::Master; }
+		virtual bool IsOpaque() const override { return m_Opaque; }
+
+		// Asset
+		virtual bool IsReference() const override { return !m_Loaded; }
+	private:
+		void SetPixels(const void* data);
+	private:
+		bool m_Loaded = false;
+
+		uint32_t m_Width = 0, m_Height = 0;
+		TextureFormat m_Format = TextureFormat::None;
+		TextureFilter m_Filter = TextureFilter::None;
+		Vec2T<TextureWrap> m_Wrap = { TextureWrap::None, TextureWrap::None };
+		bool m_Opaque = false;
+	};
+
+	class NullTexture2DArray : public Texture2DArray
+	{
+	public:
+		NullTexture2DArray(uint32_t width, uint32_t height, uint32_t layerCount, TextureFormat format)
+			: m_Width(width), m_Height(height), m_LayerCount(layerCount), m_Format(format) {}
+
+		virtual uint32_t GetWidth() const override { return m_Width; }
+		virtual uint32_t GetHeight() const override { return m_Height; }
+		virtual uint32_t GetLayerCount() const override { return m_LayerCount; }
+		virtual uint32_t GetRendererID() const override { return 0; }
+		virtual TextureFormat GetFormat() const override { return m_Format; }
+
+		virtual void Bind(uint32_t slot = 0) override {}
+
+		virtual void SetFilter(TextureFilter filter) override {}
+		virtual void SetUWrap(TextureWrap wrap) override {}
+		virtual void SetVWrap(TextureWrap wrap) override {}
+
+		virtual void CopyToLayer(const Ref<Texture2D>& texture, uint32_t layer) override;
+	private:
+		uint32_t m_Width, m_Height, m_LayerCount;
+		TextureFormat m_Format;
+	};
+}
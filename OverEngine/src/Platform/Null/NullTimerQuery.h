@@ -0,0 +1,17 @@
+#pragma once
+
+#include "OverEngine/Renderer/TimerQuery.h"
+
+namespace OverEngine
+{
+	// Always ready, nothing runs on a GPU
+	class NullTimerQuery : public TimerQuery
+	{
+	public:
+		virtual void Begin() override {}
+		virtual void End() override {}
+
+		virtual bool IsResultAvailable() const override { return true; }
+		virtual uint64_t GetResult() const override { return 0; }
+	};
+}
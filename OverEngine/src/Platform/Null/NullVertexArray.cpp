@@ -0,0 +1,11 @@
+#include "pcheader.h"
+#include "NullVertexArray.h"
+
+namespace OverEngine
+{
+	void NullVertexArray::AddVertexBuffer(const Ref<VertexBuffer>& vertexBuffer)
+	{
+		OE_CORE_ASSERT(vertexBuffer->GetLayout().GetElements().size(), "Vertex Buffer has no layout!");
+		m_VertexBuffers.push_back(vertexBuffer);
+	}
+}
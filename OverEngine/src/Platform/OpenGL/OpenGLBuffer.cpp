@@ -53,6 +53,129 @@ namespace OverEngine
 		glBufferData(GL_ARRAY_BUFFER, size, nullptr, GL_DYNAMIC_DRAW);
 	}
 
+	/////////////////////////////////////////////////////////////////////////////
+	// StreamingVertexBuffer ////////////////////////////////////////////////////
+	/////////////////////////////////////////////////////////////////////////////
+
+	static constexpr GLbitfield StreamingBufferFlags = GL_MAP_WRITE_BIT | GL_MAP_PERSISTENT_BIT | GL_MAP_COHERENT_BIT;
+
+	OpenGLStreamingVertexBuffer::OpenGLStreamingVertexBuffer(uint32_t segmentSize, uint32_t segmentCount)
+		: m_SegmentSize(segmentSize), m_SegmentCount(segmentCount), m_Fences(segmentCount, nullptr)
+	{
+		OE_CORE_ASSERT(segmentSize > 0 && segmentCount > 0, "Invalid StreamingVertexBuffer size!");
+
+		GLsizeiptr size = (GLsizeiptr)segmentSize * segmentCount;
+
+		glCreateBuffers(1, &m_RendererID);
+		glNamedBufferStorage(m_RendererID, size, nullptr, StreamingBufferFlags);
+		m_MappedData = (uint8_t*)glMapNamedBufferRange(m_RendererID, 0, size, StreamingBufferFlags);
+
+		OE_CORE_ASSERT(m_MappedData, "Failed to map StreamingVertexBuffer!");
+	}
+
+	OpenGLStreamingVertexBuffer::~OpenGLStreamingVertexBuffer()
+	{
+		for (void* fence : m_Fences)
+		{
+			if (fence)
+				glDeleteSync((GLsync)fence);
+		}
+
+		glUnmapNamedBuffer(m_RendererID);
+		glDeleteBuffers(1, &m_RendererID);
+	}
+
+	void OpenGLStreamingVertexBuffer::Bind() const
+	{
+		glBindBuffer(GL_ARRAY_BUFFER, m_RendererID);
+	}
+
+	void OpenGLStreamingVertexBuffer::Unbind() const
+	{
+		glBindBuffer(GL_ARRAY_BUFFER, 0);
+	}
+
+	void OpenGLStreamingVertexBuffer::BufferData(const void* vertices, uint32_t size, bool staticDraw) const
+	{
+		OE_CORE_ASSERT(false, "Can't BufferData into a StreamingVertexBuffer, use Reserve & Commit!");
+	}
+
+	void OpenGLStreamingVertexBuffer::BufferSubData(const void* vertices, uint32_t size, uint32_t offset) const
+	{
+		OE_CORE_ASSERT(offset + size <= m_SegmentSize * m_SegmentCount, "Out of bounds StreamingVertexBuffer write!");
+		memcpy(m_MappedData + offset, vertices, size);
+	}
+
+	void OpenGLStreamingVertexBuffer::AllocateStorage(uint32_t size) const
+	{
+		OE_CORE_ASSERT(false, "StreamingVertexBuffer has immutable storage!");
+	}
+
+	void* OpenGLStreamingVertexBuffer::Reserve(uint32_t minSize, uint32_t& available)
+	{
+		OE_CORE_ASSERT(minSize <= m_SegmentSize, "Requested size is bigger than a StreamingVertexBuffer segment!");
+
+		// Keep offsets a multiple of the stride so they can be used as a first vertex
+		if (uint32_t stride = m_Layout.GetStride())
+			m_Head = (m_Head + stride - 1) / stride * stride;
+
+		uint32_t segmentEnd = (m_CurrentSegment + 1) * m_SegmentSize;
+		if (m_Head + minSize > segmentEnd)
+		{
+			NextSegment();
+			segmentEnd = m_Head + m_SegmentSize;
+		}
+
+		available = segmentEnd - m_Head;
+		return m_MappedData + m_Head;
+	}
+
+	uint32_t OpenGLStreamingVertexBuffer::Commit(uint32_t size)
+	{
+		OE_CORE_ASSERT(m_Head + size <= (m_CurrentSegment + 1) * m_SegmentSize, "StreamingVertexBuffer segment overflow!");
+
+		uint32_t offset = m_Head;
+		m_Head += size;
+		return offset;
+	}
+
+	void OpenGLStreamingVertexBuffer::NextFrame()
+	{
+		// Nothing was written this frame
+		if (m_Head == m_CurrentSegment * m_SegmentSize)
+			return;
+
+		NextSegment();
+	}
+
+	void OpenGLStreamingVertexBuffer::NextSegment()
+	{
+		m_Fences[m_CurrentSegment] = glFenceSync(GL_SYNC_GPU_COMMANDS_COMPLETE, 0);
+
+		m_CurrentSegment = (m_CurrentSegment + 1) % m_SegmentCount;
+		m_Head = m_CurrentSegment * m_SegmentSize;
+
+		WaitForSegment(m_CurrentSegment);
+	}
+
+	void OpenGLStreamingVertexBuffer::WaitForSegment(uint32_t segment)
+	{
+		GLsync fence = (GLsync)m_Fences[segment];
+		if (!fence)
+			return;
+
+		// Only blocks when the CPU is more than `segmentCount` segments ahead of the GPU
+		while (true)
+		{
+			GLenum result = glClientWaitSync(fence, GL_SYNC_FLUSH_COMMANDS_BIT, 1000000000);
+			if (result == GL_ALREADY_SIGNALED || result == GL_CONDITION_SATISFIED || result == GL_WAIT_FAILED)
+				break;
+		}
+
+		glDeleteSync(fence);
+		m_Fences[segment] = nullptr;
+	}
+
 	/////////////////////////////////////////////////////////////////////////////
 	// IndexBuffer //////////////////////////////////////////////////////////////
 	/////////////////////////////////////////////////////////////////////////////
@@ -107,4 +230,31 @@ namespace OverEngine
 		glBindBuffer(GL_ELEMENT_ARRAY_BUFFER, m_RendererID);
 		glBufferData(GL_ELEMENT_ARRAY_BUFFER, count * sizeof(uint32_t), nullptr, GL_DYNAMIC_DRAW);
 	}
+
+	/////////////////////////////////////////////////////////////////////////////
+	// StorageBuffer ////////////////////////////////////////////////////////////
+	/////////////////////////////////////////////////////////////////////////////
+
+	OpenGLStorageBuffer::OpenGLStorageBuffer(uint32_t size, const void* data)
+		: m_Size(size)
+	{
+		glCreateBuffers(1, &m_RendererID);
+		glNamedBufferStorage(m_RendererID, size, data, GL_DYNAMIC_STORAGE_BIT);
+	}
+
+	OpenGLStorageBuffer::~OpenGLStorageBuffer()
+	{
+		glDeleteBuffers(1, &m_RendererID);
+	}
+
+	void OpenGLStorageBuffer::Bind(uint32_t binding) const
+	{
+		glBindBufferBase(GL_SHADER_STORAGE_BUFFER, binding, m_RendererID);
+	}
+
+	void OpenGLStorageBuffer::SetData(const void* data, uint32_t size, uint32_t offset)
+	{
+		OE_CORE_ASSERT(offset + size <= m_Size, "Out of bounds StorageBuffer write!");
+		glNamedBufferSubData(m_RendererID, offset, size, data);
+	}
 }
@@ -25,6 +25,46 @@ namespace OverEngine
 		BufferLayout m_Layout;
 	};
 
+	class OpenGLStreamingVertexBuffer : public StreamingVertexBuffer
+	{
+	public:
+		OpenGLStreamingVertexBuffer(uint32_t segmentSize, uint32_t segmentCount);
+		virtual ~OpenGLStreamingVertexBuffer();
+
+		virtual void Bind() const override;
+		virtual void Unbind() const override;
+
+		virtual void BufferData(const void* vertices, uint32_t size, bool staticDraw = true) const override;
+		virtual void BufferSubData(const void* vertices, uint32_t size, uint32_t offset = 0) const override;
+		virtual void AllocateStorage(uint32_t size) const override;
+
+		virtual const BufferLayout& GetLayout() const override { return m_Layout; }
+		virtual void SetLayout(const BufferLayout& layout) override { m_Layout = layout; }
+
+		virtual void* Reserve(uint32_t minSize, uint32_t& available) override;
+		virtual uint32_t Commit(uint32_t size) override;
+		virtual void NextFrame() override;
+
+		virtual uint32_t GetSegmentSize() const override { return m_SegmentSize; }
+		virtual uint32_t GetSegmentCount() const override { return m_SegmentCount; }
+	private:
+		void NextSegment();
+		void WaitForSegment(uint32_t segment);
+	private:
+		uint32_t m_RendererID = 0;
+		BufferLayout m_Layout;
+
+		uint8_t* m_MappedData = nullptr;
+		uint32_t m_SegmentSize;
+		uint32_t m_SegmentCount;
+
+		uint32_t m_CurrentSegment = 0;
+		uint32_t m_Head = 0;
+
+		// GLsync objects, one per segment
+		Vector<void*> m_Fences;
+	};
+
 	class OpenGLIndexBuffer : public IndexBuffer
 	{
 	public:
@@ -44,4 +84,21 @@ namespace OverEngine
 		uint32_t m_RendererID = 0;
 		mutable uint32_t m_Count;
 	};
+
+	class OpenGLStorageBuffer : public StorageBuffer
+	{
+	public:
+		OpenGLStorageBuffer(uint32_t size, const void* data);
+		virtual ~OpenGLStorageBuffer();
+
+		virtual void Bind(uint32_t binding) const override;
+
+		virtual void SetData(const void* data, uint32_t size, uint32_t offset = 0) override;
+
+		virtual uint32_t GetSize() const override { return m_Size; }
+		virtual uint32_t GetRendererID() const override { return m_RendererID; }
+	private:
+		uint32_t m_RendererID = 0;
+		uint32_t m_Size;
+	};
 }
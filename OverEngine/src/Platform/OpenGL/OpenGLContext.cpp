@@ -46,6 +46,11 @@ namespace OverEngine
 		glfwMakeContextCurrent(m_WindowHandle);
 	}
 
+	void OpenGLContext::Release()
+	{
+		glfwMakeContextCurrent(nullptr);
+	}
+
 	const char* OpenGLContext::GetInfoVersion()
 	{
 		return (const char*)glGetString(GL_VERSION);
@@ -15,6 +15,7 @@ namespace OverEngine
 		virtual void SwapBuffers() override;
 
 		virtual void Current() override;
+		virtual void Release() override;
 
 		virtual const char* GetInfoVersion()  override;
 		virtual const char* GetInfoVendor()   override;
@@ -5,6 +5,67 @@
 
 namespace OverEngine
 {
+	////////////////////////////////////////////////////////
+	/// Attachment pool ////////////////////////////////////
+	////////////////////////////////////////////////////////
+
+	struct FreeAttachment
+	{
+		uint32_t RendererID;
+		uint32_t IdleFrames;
+	};
+
+	// Attachments of resized and destroyed framebuffers by AttachmentKey, render thread only
+	static UnorderedMap<uint64_t, Vector<FreeAttachment>> s_FreeAttachments;
+
+	// Width (24 bits) | Height (24 bits) | Samples (8 bits) | Color format, None for depth (8 bits)
+	static uint64_t AttachmentKey(const FrameBufferProps& props, TextureFormat format)
+	{
+		return ((uint64_t)props.Width << 40) | ((uint64_t)props.Height << 16) | ((uint64_t)(props.Samples & 0xFF) << 8) | (uint64_t)format;
+	}
+
+	// 0 if there's no free attachment with that key
+	static uint32_t AcquireAttachment(uint64_t key)
+	{
+		auto it = s_FreeAttachments.find(key);
+		if (it == s_FreeAttachments.end() || it->second.empty())
+			return 0;
+
+		uint32_t rendererID = it->second.back().RendererID;
+		it->second.pop_back();
+		return rendererID;
+	}
+
+	static void ReleaseAttachment(uint64_t key, uint32_t rendererID)
+	{
+		if (rendererID)
+			s_FreeAttachments[key].push_back({ rendererID, 0 });
+	}
+
+	void OpenGLFrameBuffer::ReleaseUnusedAttachments(uint32_t maxIdleFrames)
+	{
+		for (auto it = s_FreeAttachments.begin(); it != s_FreeAttachments.end();)
+		{
+			auto& attachments = it->second;
+			attachments.erase(std::remove_if(attachments.begin(), attachments.end(), [maxIdleFrames](FreeAttachment& attachment) {
+				if (++attachment.IdleFrames <= maxIdleFrames)
+					return false;
+
+				glDeleteTextures(1, &attachment.RendererID);
+				return true;
+			}), attachments.end());
+
+			if (attachments.empty())
+				it = s_FreeAttachments.erase(it);
+			else
+				it++;
+		}
+	}
+
+	////////////////////////////////////////////////////////
+	/// OpenGLFrameBuffer //////////////////////////////////
+	////////////////////////////////////////////////////////
+
 	OpenGLFrameBuffer::OpenGLFrameBuffer(const FrameBufferProps& spec)
 		: m_Props(spec)
 	{
@@ -14,38 +75,70 @@ namespace OverEngine
 	OpenGLFrameBuffer::~OpenGLFrameBuffer()
 	{
 		glDeleteFramebuffers(1, &m_RendererID);
-		glDeleteTextures(1, &m_ColorAttachment);
-		glDeleteTextures(1, &m_DepthAttachment);
+		ReleaseAttachments();
 	}
 
-	void OpenGLFrameBuffer::Invalidate()
+	static GLenum ToOpenGLInternalFormat(TextureFormat format)
 	{
-		if (m_RendererID)
+		switch (format)
 		{
-			glDeleteFramebuffers(1, &m_RendererID);
-			glDeleteTextures(1, &m_ColorAttachment);
-			glDeleteTextures(1, &m_DepthAttachment);
+		case TextureFormat::RGB8:  return GL_RGB8;
+		case TextureFormat::RGBA8: return GL_RGBA8;
 		}
 
-		glCreateFramebuffers(1, &m_RendererID);
-		glBindFramebuffer(GL_FRAMEBUFFER, m_RendererID);
+		OE_CORE_ASSERT(false, "Unsupported FrameBuffer color format!");
+		return GL_RGBA8;
+	}
 
-		glCreateTextures(GL_TEXTURE_2D, 1, &m_ColorAttachment);
-		glBindTexture(GL_TEXTURE_2D, m_ColorAttachment);
-		glTexImage2D(GL_TEXTURE_2D, 0, GL_RGBA8, m_Props.Width, m_Props.Height, 0, GL_RGBA, GL_UNSIGNED_BYTE, nullptr);
-		glTexParameteri(GL_TEXTURE_2D, GL_TEXTURE_MIN_FILTER, GL_LINEAR);
-		glTexParameteri(GL_TEXTURE_2D, GL_TEXTURE_MAG_FILTER, GL_LINEAR);
+	void OpenGLFrameBuffer::ReleaseAttachments()
+	{
+		ReleaseAttachment(AttachmentKey(m_Props, m_Props.ColorFormat), m_ColorAttachment);
+		ReleaseAttachment(AttachmentKey(m_Props, TextureFormat::None), m_DepthAttachment);
+		m_ColorAttachment = m_DepthAttachment = 0;
+	}
 
-		glFramebufferTexture2D(GL_FRAMEBUFFER, GL_COLOR_ATTACHMENT0, GL_TEXTURE_2D, m_ColorAttachment, 0);
+	void OpenGLFrameBuffer::Invalidate()
+	{
+		// The framebuffer object is kept, only the attachments depend on the size
+		if (!m_RendererID)
+			glCreateFramebuffers(1, &m_RendererID);
 
-		glCreateTextures(GL_TEXTURE_2D, 1, &m_DepthAttachment);
-		glBindTexture(GL_TEXTURE_2D, m_DepthAttachment);
-		glTexStorage2D(GL_TEXTURE_2D, 1, GL_DEPTH24_STENCIL8, m_Props.Width, m_Props.Height);
-		glFramebufferTexture2D(GL_FRAMEBUFFER, GL_DEPTH_STENCIL_ATTACHMENT, GL_TEXTURE_2D, m_DepthAttachment, 0);
+		OE_CORE_ASSERT(!m_ColorAttachment && !m_DepthAttachment, "Attachments must be released first!");
 
-		OE_CORE_ASSERT(glCheckFramebufferStatus(GL_FRAMEBUFFER) == GL_FRAMEBUFFER_COMPLETE, "FrameBuffer is incomplete!");
+		m_ColorAttachment = AcquireAttachment(AttachmentKey(m_Props, m_Props.ColorFormat));
+		m_DepthAttachment = AcquireAttachment(AttachmentKey(m_Props, TextureFormat::None));
 
-		glBindFramebuffer(GL_FRAMEBUFFER, 0);
+		GLenum colorFormat = ToOpenGLInternalFormat(m_Props.ColorFormat);
+		GLenum target = m_Props.Samples > 1 ? GL_TEXTURE_2D_MULTISAMPLE : GL_TEXTURE_2D;
+
+		if (!m_ColorAttachment)
+		{
+			glCreateTextures(target, 1, &m_ColorAttachment);
+			if (m_Props.Samples > 1)
+			{
+				glTextureStorage2DMultisample(m_ColorAttachment, m_Props.Samples, colorFormat, m_Props.Width, m_Props.Height, GL_TRUE);
+			}
+			else
+			{
+				glTextureStorage2D(m_ColorAttachment, 1, colorFormat, m_Props.Width, m_Props.Height);
+				glTextureParameteri(m_ColorAttachment, GL_TEXTURE_MIN_FILTER, GL_LINEAR);
+				glTextureParameteri(m_ColorAttachment, GL_TEXTURE_MAG_FILTER, GL_LINEAR);
+			}
+		}
+
+		if (!m_DepthAttachment)
+		{
+			glCreateTextures(target, 1, &m_DepthAttachment);
+			if (m_Props.Samples > 1)
+				glTextureStorage2DMultisample(m_DepthAttachment, m_Props.Samples, GL_DEPTH24_STENCIL8, m_Props.Width, m_Props.Height, GL_TRUE);
+			else
+				glTextureStorage2D(m_DepthAttachment, 1, GL_DEPTH24_STENCIL8, m_Props.Width, m_Props.Height);
+		}
+
+		glNamedFramebufferTexture(m_RendererID, GL_COLOR_ATTACHMENT0, m_ColorAttachment, 0);
+		glNamedFramebufferTexture(m_RendererID, GL_DEPTH_STENCIL_ATTACHMENT, m_DepthAttachment, 0);
+
+		OE_CORE_ASSERT(glCheckNamedFramebufferStatus(m_RendererID, GL_FRAMEBUFFER) == GL_FRAMEBUFFER_COMPLETE, "FrameBuffer is incomplete!");
 	}
 
 	void OpenGLFrameBuffer::Bind()
@@ -61,6 +154,12 @@ namespace OverEngine
 
 	void OpenGLFrameBuffer::Resize(uint32_t width, uint32_t height)
 	{
+		if (width == m_Props.Width && height == m_Props.Height)
+			return;
+
+		// Recycled with the old size, the new size may find some in the pool
+		ReleaseAttachments();
+
 		m_Props.Width = width;
 		m_Props.Height = height;
 
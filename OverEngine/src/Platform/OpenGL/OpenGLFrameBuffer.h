@@ -20,6 +20,12 @@ namespace OverEngine
 		virtual uint32_t GetColorAttachmentRendererID() const override { return m_ColorAttachment; }
 
 		virtual const FrameBufferProps& GetProps() const override { return m_Props; }
+
+		// See FrameBuffer::ReleaseUnusedAttachments, render thread only
+		static void ReleaseUnusedAttachments(uint32_t maxIdleFrames);
+	private:
+		// Gives the attachments to the pool shared by all the framebuffers
+		void ReleaseAttachments();
 	private:
 		uint32_t m_RendererID = 0;
 		uint32_t m_ColorAttachment = 0, m_DepthAttachment = 0;
@@ -74,16 +74,58 @@ namespace OverEngine
 		glClear(mask);
 	}
 
+	static GLenum DrawTypeToOpenGLMode(DrawType drawType)
+	{
+		switch (drawType)
+		{
+		case DrawType::Points:        return GL_POINTS;
+		case DrawType::Lines:         return GL_LINES;
+		case DrawType::Triangles:     return GL_TRIANGLES;
+		case DrawType::TriangleStrip: return GL_TRIANGLE_STRIP;
+		default:;
+		}
+
+		return GL_TRIANGLES;
+	}
+
 	void OpenGLRendererAPI::DrawIndexed(const Ref<VertexArray>& vertexArray, uint32_t indexCount, DrawType drawType)
 	{
 		uint32_t count = indexCount ? indexCount : vertexArray->GetIndexBuffer()->GetCount();
+		glDrawElements(DrawTypeToOpenGLMode(drawType), count, GL_UNSIGNED_INT, nullptr);
+	}
+
+	void OpenGLRendererAPI::DrawArrays(const Ref<VertexArray>& vertexArray, uint32_t first, uint32_t count, DrawType drawType)
+	{
+		glDrawArrays(DrawTypeToOpenGLMode(drawType), first, count);
+	}
+
+	void OpenGLRendererAPI::DrawInstanced(const Ref<VertexArray>& vertexArray, uint32_t vertexCount, uint32_t instanceCount, uint32_t baseInstance, DrawType drawType)
+	{
+		glDrawArraysInstancedBaseInstance(DrawTypeToOpenGLMode(drawType), 0, vertexCount, instanceCount, baseInstance);
+	}
+
+	void OpenGLRendererAPI::DrawIndirect(const Ref<VertexArray>& vertexArray, const Ref<StorageBuffer>& commands, uint32_t offset, DrawType drawType)
+	{
+		glBindBuffer(GL_DRAW_INDIRECT_BUFFER, commands->GetRendererID());
+		glDrawArraysIndirect(DrawTypeToOpenGLMode(drawType), (const void*)(uintptr_t)offset);
+		glBindBuffer(GL_DRAW_INDIRECT_BUFFER, 0);
+	}
 
-		GLenum mode = GL_TRIANGLES;
-		if (drawType == DrawType::Points)         mode = GL_POINTS;
-		else if (drawType == DrawType::Lines)     mode = GL_LINES;
-		else if (drawType == DrawType::Triangles) mode = GL_TRIANGLES;
+	void OpenGLRendererAPI::DispatchCompute(uint32_t groupCountX, uint32_t groupCountY, uint32_t groupCountZ)
+	{
+		glDispatchCompute(groupCountX, groupCountY, groupCountZ);
+	}
 
-		glDrawElements(mode, count, GL_UNSIGNED_INT, nullptr);
+	void OpenGLRendererAPI::Barrier(BarrierFlags flags)
+	{
+		GLbitfield barriers = 0;
+		if (flags & BarrierFlags_Storage)
+			barriers |= GL_SHADER_STORAGE_BARRIER_BIT;
+		if (flags & BarrierFlags_Command)
+			barriers |= GL_COMMAND_BARRIER_BIT;
+
+		if (barriers)
+			glMemoryBarrier(barriers);
 	}
 
 	uint32_t OpenGLRendererAPI::GetMaxTextureSize()
@@ -114,4 +156,24 @@ namespace OverEngine
 	{
 		glEnable(GL_DEPTH_TEST);
 	}
+
+	void OpenGLRendererAPI::DisableDepthWriting()
+	{
+		glDepthMask(GL_FALSE);
+	}
+
+	void OpenGLRendererAPI::EnableDepthWriting()
+	{
+		glDepthMask(GL_TRUE);
+	}
+
+	void OpenGLRendererAPI::DisableBlending()
+	{
+		glDisable(GL_BLEND);
+	}
+
+	void OpenGLRendererAPI::EnableBlending()
+	{
+		glEnable(GL_BLEND);
+	}
 }
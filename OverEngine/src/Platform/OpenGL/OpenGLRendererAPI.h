@@ -15,6 +15,12 @@ namespace OverEngine
 		virtual void Clear(const ClearFlags& flags) override;
 
 		virtual void DrawIndexed(const Ref<VertexArray>& vertexArray, uint32_t indexCount = 0, DrawType drawType = DrawType::Triangles) override;
+		virtual void DrawArrays(const Ref<VertexArray>& vertexArray, uint32_t first, uint32_t count, DrawType drawType = DrawType::Triangles) override;
+		virtual void DrawInstanced(const Ref<VertexArray>& vertexArray, uint32_t vertexCount, uint32_t instanceCount, uint32_t baseInstance = 0, DrawType drawType = DrawType::Triangles) override;
+		virtual void DrawIndirect(const Ref<VertexArray>& vertexArray, const Ref<StorageBuffer>& commands, uint32_t offset = 0, DrawType drawType = DrawType::Triangles) override;
+
+		virtual void DispatchCompute(uint32_t groupCountX, uint32_t groupCountY = 1, uint32_t groupCountZ = 1) override;
+		virtual void Barrier(BarrierFlags flags) override;
 
 		virtual uint32_t GetMaxTextureSize() override;
 		virtual uint32_t GetMaxTextureSlotCount() override;
@@ -22,5 +28,11 @@ namespace OverEngine
 		virtual bool IsDepthTestingEnabled() override;
 		virtual void DisableDepthTesting() override;
 		virtual void EnableDepthTesting() override;
+
+		virtual void DisableDepthWriting() override;
+		virtual void EnableDepthWriting() override;
+
+		virtual void DisableBlending() override;
+		virtual void EnableBlending() override;
 	};
 }
@@ -15,6 +15,8 @@ namespace OverEngine
 			return GL_FRAGMENT_SHADER;
 		if (type == "geometry")
 			return GL_GEOMETRY_SHADER;
+		if (type == "compute")
+			return GL_COMPUTE_SHADER;
 
 		OE_CORE_ASSERT(false, "Unknown shader type '{0}'!", type);
 		return 0;
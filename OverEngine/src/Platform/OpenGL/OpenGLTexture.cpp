@@ -80,26 +80,59 @@ namespace OverEngine
 		m_Wrap = { TextureWrap::Repeat, TextureWrap::Repeat };
 
 		// Upload image to GPU
+		CreateStorage(data);
+
+		// Free image buffer created by stb_image
+		stbi_image_free(data);
+	}
+
+	OpenGLTexture2D::OpenGLTexture2D(const uint64_t& guid)
+	{
+		SetGuid(guid);
+	}
+
+	OpenGLTexture2D::OpenGLTexture2D(uint32_t width, uint32_t height, TextureFormat format, const void* data)
+		: m_Width(width), m_Height(height), m_Format(format)
+	{
+		OE_CORE_ASSERT(m_Format != TextureFormat::None, "Unsupported texture format!");
+
+		m_Filter = TextureFilter::BiLinear;
+		m_Wrap = { TextureWrap::Repeat, TextureWrap::Repeat };
+
+		CreateStorage(data);
+	}
+
+	void OpenGLTexture2D::CreateStorage(const void* data)
+	{
 		auto glFormat = GetOpenGLDataAndInternalFormat(m_Format);
 
 		glCreateTextures(GL_TEXTURE_2D, 1, &m_RendererID);
 		glTextureStorage2D(m_RendererID, 1, glFormat.InternalFormat, m_Width, m_Height);
 
-		glTextureParameteri(m_RendererID, GL_TEXTURE_MIN_FILTER, GL_LINEAR);
-		glTextureParameteri(m_RendererID, GL_TEXTURE_MAG_FILTER, GL_LINEAR);
+		glTextureParameteri(m_RendererID, GL_TEXTURE_MIN_FILTER, GetOpenGLTextureFilter(m_Filter));
+		glTextureParameteri(m_RendererID, GL_TEXTURE_MAG_FILTER, GetOpenGLTextureFilter(m_Filter));
 
-		glTextureParameteri(m_RendererID, GL_TEXTURE_WRAP_S, GL_REPEAT);
-		glTextureParameteri(m_RendererID, GL_TEXTURE_WRAP_T, GL_REPEAT);
+		glTextureParameteri(m_RendererID, GL_TEXTURE_WRAP_S, GetOpenGLTextureWrap(m_Wrap.u));
+		glTextureParameteri(m_RendererID, GL_TEXTURE_WRAP_T, GetOpenGLTextureWrap(m_Wrap.v));
 
-		glTextureSubImage2D(m_RendererID, 0, 0, 0, m_Width, m_Height, glFormat.DataFormat, GL_UNSIGNED_BYTE, data);
+		m_Opaque = m_Format == TextureFormat::RGB8;
+		if (data && m_Format == TextureFormat::RGBA8)
+		{
+			const uint8_t* pixels = static_cast<const uint8_t*>(data);
+			size_t size = (size_t)m_Width * m_Height * 4;
 
-		// Free image buffer created by stb_image
-		stbi_image_free(data);
-	}
+			m_Opaque = true;
+			for (size_t i = 3; i < size && m_Opaque; i += 4)
+				m_Opaque = pixels[i] == 0xFF;
+		}
 
-	OpenGLTexture2D::OpenGLTexture2D(const uint64_t& guid)
-	{
-		SetGuid(guid);
+		if (data)
+		{
+			// Rows of RGB8 images are not 4 byte aligned
+			glPixelStorei(GL_UNPACK_ALIGNMENT, 1);
+			glTextureSubImage2D(m_RendererID, 0, 0, 0, m_Width, m_Height, glFormat.DataFormat, GL_UNSIGNED_BYTE, data);
+			glPixelStorei(GL_UNPACK_ALIGNMENT, 4);
+		}
 	}
 
 	void OpenGLTexture2D::Acquire(Ref<Asset> other)
@@ -112,6 +145,8 @@ namespace OverEngine
 			m_Format     = otherGLTexture->m_Format;
 			m_Filter     = otherGLTexture->m_Filter;
 			m_Wrap       = otherGLTexture->m_Wrap;
+			m_Opaque     = otherGLTexture->m_Opaque;
+			m_Generation++;
 
 			otherGLTexture->m_RendererID = 0;
 		}
@@ -188,4 +223,64 @@ namespace OverEngine
 	{
 		return TextureType::Master;
 	}
+
+	/////////////////////////////////////////////////////////////////////////////
+	// Texture2DArray ///////////////////////////////////////////////////////////
+	/////////////////////////////////////////////////////////////////////////////
+
+	OpenGLTexture2DArray::OpenGLTexture2DArray(uint32_t width, uint32_t height, uint32_t layerCount, TextureFormat format)
+		: m_Width(width), m_Height(height), m_LayerCount(layerCount), m_Format(format)
+	{
+		auto glFormat = GetOpenGLDataAndInternalFormat(m_Format);
+		OE_CORE_ASSERT(glFormat.InternalFormat, "Unsupported Texture2DArray format!");
+
+		glCreateTextures(GL_TEXTURE_2D_ARRAY, 1, &m_RendererID);
+		glTextureStorage3D(m_RendererID, 1, glFormat.InternalFormat, m_Width, m_Height, m_LayerCount);
+
+		glTextureParameteri(m_RendererID, GL_TEXTURE_MIN_FILTER, GL_LINEAR);
+		glTextureParameteri(m_RendererID, GL_TEXTURE_MAG_FILTER, GL_LINEAR);
+
+		glTextureParameteri(m_RendererID, GL_TEXTURE_WRAP_S, GL_REPEAT);
+		glTextureParameteri(m_RendererID, GL_TEXTURE_WRAP_T, GL_REPEAT);
+	}
+
+	OpenGLTexture2DArray::~OpenGLTexture2DArray()
+	{
+		glDeleteTextures(1, &m_RendererID);
+	}
+
+	void OpenGLTexture2DArray::Bind(uint32_t slot)
+	{
+		glBindTextureUnit(slot, m_RendererID);
+	}
+
+	void OpenGLTexture2DArray::SetFilter(TextureFilter filter)
+	{
+		GLenum glFilter = GetOpenGLTextureFilter(filter);
+		glTextureParameteri(m_RendererID, GL_TEXTURE_MIN_FILTER, glFilter);
+		glTextureParameteri(m_RendererID, GL_TEXTURE_MAG_FILTER, glFilter);
+	}
+
+	void OpenGLTexture2DArray::SetUWrap(TextureWrap wrap)
+	{
+		glTextureParameteri(m_RendererID, GL_TEXTURE_WRAP_S, GetOpenGLTextureWrap(wrap));
+	}
+
+	void OpenGLTexture2DArray::SetVWrap(TextureWrap wrap)
+	{
+		glTextureParameteri(m_RendererID, GL_TEXTURE_WRAP_T, GetOpenGLTextureWrap(wrap));
+	}
+
+	void OpenGLTexture2DArray::CopyToLayer(const Ref<Texture2D>& texture, uint32_t layer)
+	{
+		OE_CORE_ASSERT(layer < m_LayerCount, "Texture2DArray layer out of range!");
+		OE_CORE_ASSERT(texture->GetWidth() == m_Width && texture->GetHeight() == m_Height && texture->GetFormat() == m_Format,
+			"Texture doesn't match the Texture2DArray!");
+
+		glCopyImageSubData(
+			texture->GetRendererID(), GL_TEXTURE_2D, 0, 0, 0, 0,
+			m_RendererID, GL_TEXTURE_2D_ARRAY, 0, 0, 0, layer,
+			m_Width, m_Height, 1
+		);
+	}
 }
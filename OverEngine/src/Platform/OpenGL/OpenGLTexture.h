@@ -10,6 +10,7 @@ namespace OverEngine
 	public:
 		OpenGLTexture2D(const String& path);
 		OpenGLTexture2D(const uint64_t& guid);
+		OpenGLTexture2D(uint32_t width, uint32_t height, TextureFormat format, const void* data);
 		virtual void Acquire(Ref<Asset> other) override;
 
 		virtual ~OpenGLTexture2D();
@@ -34,10 +35,13 @@ namespace OverEngine
 		// Other
 		virtual TextureFormat GetFormat() const override;
 		virtual TextureType GetType() const override;
+		virtual bool IsOpaque() const override { return m_Opaque; }
 
 		// Asset
 		virtual bool IsReference() const override { return m_RendererID == 0; }
 	private:
+		void CreateStorage(const void* data);
+	private:
 
 		uint32_t m_RendererID = 0;
 
@@ -45,5 +49,32 @@ namespace OverEngine
 		TextureFormat m_Format = TextureFormat::None;
 		TextureFilter m_Filter = TextureFilter::None;
 		Vec2T<TextureWrap> m_Wrap = { TextureWrap::None, TextureWrap::None };
+		bool m_Opaque = false;
+	};
+
+	class OpenGLTexture2DArray : public Texture2DArray
+	{
+	public:
+		OpenGLTexture2DArray(uint32_t width, uint32_t height, uint32_t layerCount, TextureFormat format);
+		virtual ~OpenGLTexture2DArray();
+
+		virtual uint32_t GetWidth() const override { return m_Width; }
+		virtual uint32_t GetHeight() const override { return m_Height; }
+		virtual uint32_t GetLayerCount() const override { return m_LayerCount; }
+		virtual uint32_t GetRendererID() const override { return m_RendererID; }
+		virtual TextureFormat GetFormat() const override { return m_Format; }
+
+		virtual void Bind(uint32_t slot = 0) override;
+
+		virtual void SetFilter(TextureFilter filter) override;
+		virtual void SetUWrap(TextureWrap wrap) override;
+		virtual void SetVWrap(TextureWrap wrap) override;
+
+		virtual void CopyToLayer(const Ref<Texture2D>& texture, uint32_t layer) override;
+	private:
+		uint32_t m_RendererID = 0;
+
+		uint32_t m_Width, m_Height, m_LayerCount;
+		TextureFormat m_Format;
 	};
 }
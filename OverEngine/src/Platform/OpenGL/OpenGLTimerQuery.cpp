@@ -0,0 +1,41 @@
+#include "pcheader.h"
+#include "OpenGLTimerQuery.h"
+
+#include <glad/gl.h>
+
+namespace OverEngine
+{
+	OpenGLTimerQuery::OpenGLTimerQuery()
+	{
+		glCreateQueries(GL_TIME_ELAPSED, 1, &m_RendererID);
+	}
+
+	OpenGLTimerQuery::~OpenGLTimerQuery()
+	{
+		glDeleteQueries(1, &m_RendererID);
+	}
+
+	void OpenGLTimerQuery::Begin()
+	{
+		glBeginQuery(GL_TIME_ELAPSED, m_RendererID);
+	}
+
+	void OpenGLTimerQuery::End()
+	{
+		glEndQuery(GL_TIME_ELAPSED);
+	}
+
+	bool OpenGLTimerQuery::IsResultAvailable() const
+	{
+		GLint available = GL_FALSE;
+		glGetQueryObjectiv(m_RendererID, GL_QUERY_RESULT_AVAILABLE, &available);
+		return available == GL_TRUE;
+	}
+
+	uint64_t OpenGLTimerQuery::GetResult() const
+	{
+		GLuint64 result = 0;
+		glGetQueryObjectui64v(m_RendererID, GL_QUERY_RESULT, &result);
+		return result;
+	}
+}
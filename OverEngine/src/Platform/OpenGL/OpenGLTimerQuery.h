@@ -0,0 +1,21 @@
+#pragma once
+
+#include "OverEngine/Renderer/TimerQuery.h"
+
+namespace OverEngine
+{
+	class OpenGLTimerQuery : public TimerQuery
+	{
+	public:
+		OpenGLTimerQuery();
+		virtual ~OpenGLTimerQuery();
+
+		virtual void Begin() override;
+		virtual void End() override;
+
+		virtual bool IsResultAvailable() const override;
+		virtual uint64_t GetResult() const override;
+	private:
+		uint32_t m_RendererID;
+	};
+}
@@ -19,7 +19,12 @@ namespace OverEngine
 		case ShaderDataType::Int2:     return GL_INT;
 		case ShaderDataType::Int3:     return GL_INT;
 		case ShaderDataType::Int4:     return GL_INT;
+		case ShaderDataType::UInt:     return GL_UNSIGNED_INT;
 		case ShaderDataType::Bool:     return GL_BOOL;
+		case ShaderDataType::UByte4:   return GL_UNSIGNED_BYTE;
+		case ShaderDataType::UShort4:  return GL_UNSIGNED_SHORT;
+		case ShaderDataType::Half2:    return GL_HALF_FLOAT;
+		case ShaderDataType::Half4:    return GL_HALF_FLOAT;
 		default:;
 		}
 
@@ -60,11 +65,12 @@ namespace OverEngine
 		{
 			glEnableVertexAttribArray(index + m_VertexBufferIndexOffset);
 
-			if (ShaderDataTypeToOpenGLBaseType(element.Type) == GL_INT)
+			GLenum baseType = ShaderDataTypeToOpenGLBaseType(element.Type);
+			if (baseType == GL_INT || baseType == GL_UNSIGNED_INT)
 			{
 				glVertexAttribIPointer(index + m_VertexBufferIndexOffset,
 					element.GetComponentCount(),
-					ShaderDataTypeToOpenGLBaseType(element.Type),
+					baseType,
 					layout.GetStride(),
 					(const void*)(intptr_t)element.Offset
 				);
@@ -73,12 +79,16 @@ namespace OverEngine
 			{
 				glVertexAttribPointer(index + m_VertexBufferIndexOffset,
 					element.GetComponentCount(),
-					ShaderDataTypeToOpenGLBaseType(element.Type),
+					baseType,
 					element.Normalized ? GL_TRUE : GL_FALSE,
 					layout.GetStride(),
 					(const void*)(intptr_t)element.Offset
 				);
 			}
+
+			if (layout.IsPerInstance())
+				glVertexAttribDivisor(index + m_VertexBufferIndexOffset, 1);
+
 			index++;
 		}
 
@@ -9,6 +9,7 @@
 
 #include "OverEngine/Renderer/GraphicsContext.h"
 #include "OverEngine/Renderer/RendererAPI.h"
+#include "OverEngine/Renderer/RenderCommand.h"
 
 namespace OverEngine
 {
@@ -59,6 +60,11 @@ namespace OverEngine
 				glfwWindowHint(GLFW_OPENGL_DEBUG_CONTEXT, GLFW_TRUE);
 			#endif
 		}
+		else if (RendererAPI::GetAPI() == RendererAPI::API::None)
+		{
+			// Events only, the null renderer draws nothing
+			glfwWindowHint(GLFW_CLIENT_API, GLFW_NO_API);
+		}
 
 		m_Window = glfwCreateWindow((int)props.Width, (int)props.Height, m_Data.Title.c_str(), nullptr, nullptr);
 		s_WindowCount++;
@@ -195,15 +201,16 @@ namespace OverEngine
 	void WindowsWindow::OnUpdate()
 	{
 		glfwPollEvents();
-		m_Context->SwapBuffers();
+
+		// Events stay on this thread, the swap goes with the context
+		GraphicsContext* context = m_Context.get();
+		RenderCommand::Submit([context]() { context->SwapBuffers(); });
 	}
 
 	void WindowsWindow::SetVSync(bool enabled)
 	{
-		if (enabled)
-			glfwSwapInterval(1);
-		else
-			glfwSwapInterval(0);
+		if (RendererAPI::GetAPI() != RendererAPI::API::None)
+			RenderCommand::Submit([enabled]() { glfwSwapInterval(enabled ? 1 : 0); });
 
 		m_Data.VSync = enabled;
 	}
@@ -1,43 +1,66 @@
 #type vertex
 #version 450 core
 
-layout(location = 0) in vec3 a_Position0;
-layout(location = 1) in vec3 a_Position1;
-layout(location = 2) in vec3 a_Position2;
-layout(location = 3) in vec3 a_Position3;
-
-layout(location = 4) in vec4 a_Color;
-layout(location = 5) in int  a_TexSlot;
-layout(location = 6) in vec4 a_TexCoord;
-layout(location = 7) in vec4 a_TexRegion;
-layout(location = 8) in int a_TexRepeat;
+layout(location = 0) in vec3 a_Position;
+layout(location = 1) in vec4 a_Transform;
+layout(location = 2) in vec4 a_Color;
+layout(location = 3) in vec4 a_TexRect;
+layout(location = 4) in vec4 a_TexTiling;
+layout(location = 5) in uint a_TexFlags;
+
+// Must match QuadFlags in Renderer2D.cpp
+#define NO_TEXTURE  0xFFu
+#define SLOT_MASK   0xFFu
+#define LAYER_SHIFT 8
+#define LAYER_MASK  0xFFFu
+#define FLIP_X      (1u << 24)
+#define FLIP_Y      (1u << 25)
+#define REPEAT      (1u << 26)
+#define SDF         (1u << 28)
 
 out VS_OUT {
-	// Position0 -> gl_Position;
-	vec3 Position1;
-	vec3 Position2;
-	vec3 Position3;
+	vec4 Transform;
 
 	vec4 Color;
 	int  TexSlot;
+	int  TexLayer;
 	vec4 TexCoord;
 	vec4 TexRegion;
 	int TexRepeat;
+	int TexSdf;
 } vs_out;
 
 void main()
 {
-	// gl_Position is used insted of vs_out.Position0
-	gl_Position      = vec4(a_Position0, 1.0);
-	vs_out.Position1 = a_Position1;
-	vs_out.Position2 = a_Position2;
-	vs_out.Position3 = a_Position3;
-
+	// gl_Position is used insted of vs_out.Position
+	gl_Position      = vec4(a_Position, 1.0);
+	vs_out.Transform = a_Transform;
 	vs_out.Color     = a_Color;
-	vs_out.TexSlot   = a_TexSlot;
-	vs_out.TexCoord  = a_TexCoord;
-	vs_out.TexRegion = a_TexRegion;
-	vs_out.TexRepeat = a_TexRepeat;
+
+	uint slot = a_TexFlags & SLOT_MASK;
+	vs_out.TexSlot   = slot == NO_TEXTURE ? -1 : int(slot);
+	vs_out.TexLayer  = int((a_TexFlags >> LAYER_SHIFT) & LAYER_MASK);
+	vs_out.TexRepeat = (a_TexFlags & REPEAT) != 0u ? 1 : 0;
+	vs_out.TexSdf    = (a_TexFlags & SDF) != 0u ? 1 : 0;
+
+	// Apply tiling & offset then flipping
+	vec4 coord  = vec4(a_TexRect.xy * a_TexTiling.xy + a_TexTiling.zw, a_TexRect.zw * a_TexTiling.xy);
+	vec4 region = a_TexRect;
+
+	if ((a_TexFlags & FLIP_X) != 0u)
+	{
+		coord.x  += coord.z;  coord.z  = -coord.z;
+		region.x += region.z; region.z = -region.z;
+	}
+
+	if ((a_TexFlags & FLIP_Y) != 0u)
+	{
+		coord.y  += coord.w;  coord.w  = -coord.w;
+		region.y += region.w; region.w = -region.w;
+	}
+
+	vs_out.TexCoord  = coord;
+	vs_out.TexRegion = region;
 }
 
 #type geometry
@@ -47,49 +70,51 @@ layout (points) in;
 layout (triangle_strip, max_vertices = 4) out;
 
 in VS_OUT {
-	// Position0 -> gl_Position;
-	vec3 Position1;
-	vec3 Position2;
-	vec3 Position3;
+	vec4 Transform;
 
 	vec4 Color;
 	int  TexSlot;
+	int  TexLayer;
 	vec4 TexCoord;
 	vec4 TexRegion;
 	int TexRepeat;
+	int TexSdf;
 } gs_in[];
 
 flat out vec4 v_Color;
 flat out int v_TexSlot;
+flat out int v_TexLayer;
 flat out vec4 v_TexRegion;
 flat out int v_TexRepeat;
+flat out int v_TexSdf;
 out vec2 v_TexCoord;
 
-#define FLIP_X (1 << 0)
-#define FLIP_Y (1 << 1)
+uniform mat4 u_ViewProjMatrix;
+
+void EmitCorner(vec2 corner, vec2 texCoord)
+{
+	vec3 position = gl_in[0].gl_Position.xyz;
+	position.xy += gs_in[0].Transform.xy * corner.x + gs_in[0].Transform.zw * corner.y;
+
+	gl_Position = u_ViewProjMatrix * vec4(position, 1.0);
+	v_TexCoord  = texCoord;
+	EmitVertex();
+}
 
 void main()
 {
 	v_Color     = gs_in[0].Color;
 	v_TexSlot   = gs_in[0].TexSlot;
+	v_TexLayer  = gs_in[0].TexLayer;
 	v_TexRegion = gs_in[0].TexRegion;
 	v_TexRepeat = gs_in[0].TexRepeat;
+	v_TexSdf    = gs_in[0].TexSdf;
 
-	gl_Position = gl_in[0].gl_Position;
-	v_TexCoord  = gs_in[0].TexCoord.xy + vec2(0.0, gs_in[0].TexCoord.w);
-	EmitVertex();
-
-	gl_Position = vec4(gs_in[0].Position1, 1.0);
-	v_TexCoord  = gs_in[0].TexCoord.xy + gs_in[0].TexCoord.zw;
-	EmitVertex();
-
-	gl_Position = vec4(gs_in[0].Position2, 1.0);
-	v_TexCoord  = gs_in[0].TexCoord.xy;
-	EmitVertex();
-
-	gl_Position = vec4(gs_in[0].Position3, 1.0);
-	v_TexCoord  = gs_in[0].TexCoord.xy + vec2(gs_in[0].TexCoord.z, 0.0);
-	EmitVertex();
+	vec4 texCoord = gs_in[0].TexCoord;
+	EmitCorner(vec2(-0.5, -0.5), texCoord.xy + vec2(0.0, texCoord.w));
+	EmitCorner(vec2( 0.5, -0.5), texCoord.xy + texCoord.zw);
+	EmitCorner(vec2(-0.5,  0.5), texCoord.xy);
+	EmitCorner(vec2( 0.5,  0.5), texCoord.xy + vec2(texCoord.z, 0.0));
 
 	EndPrimitive();
 }
@@ -102,63 +127,94 @@ layout(location = 0) out vec4 o_Color;
 
 flat in vec4 v_Color;
 flat in int v_TexSlot;
+flat in int v_TexLayer;
 flat in vec4 v_TexRegion;
 flat in int v_TexRepeat;
+flat in int v_TexSdf;
 in vec2 v_TexCoord;
 
-uniform sampler2D[32] u_Slots;
+// Slots [0, 16) are textures, [16, 32) are texture arrays
+uniform sampler2D[16] u_Slots;
+uniform sampler2DArray[16] u_ArraySlots;
 
 #define EPSILON1 (0.0000000000001)
 #define EPSILON2 (0.0001)
-#define INT_NOT(x) (int(!bool(x)))
 
-void Sample(sampler2D slot)
+vec2 GetTexCoord()
 {
 	vec2 coord = v_TexCoord;
 
-	coord = (v_TexRepeat == 1) ? vec2(mod(coord.x - v_TexRegion.x, v_TexRegion.z) + v_TexRegion.x, mod(coord.y - v_TexRegion.x, v_TexRegion.w) + v_TexRegion.y) : coord;
-	coord += EPSILON2 * v_TexRepeat * vec2(coord.x < v_TexRegion.x + EPSILON1, coord.y < v_TexRegion.y + EPSILON1);
+	if (v_TexRepeat == 1)
+	{
+		coord -= v_TexRegion.xy;
+		coord.x = mod(coord.x, v_TexRegion.z);
+		coord.y = mod(coord.y, v_TexRegion.w);
+		coord += v_TexRegion.xy;
+		if (coord.x < v_TexRegion.x + EPSILON1)
+			coord.x += EPSILON2;
+		if (coord.y < v_TexRegion.y + EPSILON1)
+			coord.y += EPSILON2;
+	}
 
-	o_Color *= texture(slot, coord);
-	if (o_Color.a == 0.0) discard;
+	return coord;
 }
 
 void main()
 {
 	o_Color = v_Color;
+	if (v_TexSlot < 0)
+		return;
+
+	vec2 coord = GetTexCoord();
+	vec3 arrayCoord = vec3(coord, float(v_TexLayer));
+
+	vec4 texel = vec4(1.0);
 	switch (v_TexSlot)
 	{
-	case  0: Sample(u_Slots[0 ]); return;
-	case  1: Sample(u_Slots[1 ]); return;
-	case  2: Sample(u_Slots[2 ]); return;
-	case  3: Sample(u_Slots[3 ]); return;
-	case  4: Sample(u_Slots[4 ]); return;
-	case  5: Sample(u_Slots[5 ]); return;
-	case  6: Sample(u_Slots[6 ]); return;
-	case  7: Sample(u_Slots[7 ]); return;
-	case  8: Sample(u_Slots[8 ]); return;
-	case  9: Sample(u_Slots[9 ]); return;
-	case 10: Sample(u_Slots[10]); return;
-	case 11: Sample(u_Slots[11]); return;
-	case 12: Sample(u_Slots[12]); return;
-	case 13: Sample(u_Slots[13]); return;
-	case 14: Sample(u_Slots[14]); return;
-	case 15: Sample(u_Slots[15]); return;
-	case 16: Sample(u_Slots[16]); return;
-	case 17: Sample(u_Slots[17]); return;
-	case 18: Sample(u_Slots[18]); return;
-	case 19: Sample(u_Slots[19]); return;
-	case 20: Sample(u_Slots[20]); return;
-	case 21: Sample(u_Slots[21]); return;
-	case 22: Sample(u_Slots[22]); return;
-	case 23: Sample(u_Slots[23]); return;
-	case 24: Sample(u_Slots[24]); return;
-	case 25: Sample(u_Slots[25]); return;
-	case 26: Sample(u_Slots[26]); return;
-	case 27: Sample(u_Slots[27]); return;
-	case 28: Sample(u_Slots[28]); return;
-	case 29: Sample(u_Slots[29]); return;
-	case 30: Sample(u_Slots[30]); return;
-	case 31: Sample(u_Slots[31]); return;
+	case  0: texel = texture(u_Slots[0 ], coord); break;
+	case  1: texel = texture(u_Slots[1 ], coord); break;
+	case  2: texel = texture(u_Slots[2 ], coord); break;
+	case  3: texel = texture(u_Slots[3 ], coord); break;
+	case  4: texel = texture(u_Slots[4 ], coord); break;
+	case  5: texel = texture(u_Slots[5 ], coord); break;
+	case  6: texel = texture(u_Slots[6 ], coord); break;
+	case  7: texel = texture(u_Slots[7 ], coord); break;
+	case  8: texel = texture(u_Slots[8 ], coord); break;
+	case  9: texel = texture(u_Slots[9 ], coord); break;
+	case 10: texel = texture(u_Slots[10], coord); break;
+	case 11: texel = texture(u_Slots[11], coord); break;
+	case 12: texel = texture(u_Slots[12], coord); break;
+	case 13: texel = texture(u_Slots[13], coord); break;
+	case 14: texel = texture(u_Slots[14], coord); break;
+	case 15: texel = texture(u_Slots[15], coord); break;
+	case 16: texel = texture(u_ArraySlots[0 ], arrayCoord); break;
+	case 17: texel = texture(u_ArraySlots[1 ], arrayCoord); break;
+	case 18: texel = texture(u_ArraySlots[2 ], arrayCoord); break;
+	case 19: texel = texture(u_ArraySlots[3 ], arrayCoord); break;
+	case 20: texel = texture(u_ArraySlots[4 ], arrayCoord); break;
+	case 21: texel = texture(u_ArraySlots[5 ], arrayCoord); break;
+	case 22: texel = texture(u_ArraySlots[6 ], arrayCoord); break;
+	case 23: texel = texture(u_ArraySlots[7 ], arrayCoord); break;
+	case 24: texel = texture(u_ArraySlots[8 ], arrayCoord); break;
+	case 25: texel = texture(u_ArraySlots[9 ], arrayCoord); break;
+	case 26: texel = texture(u_ArraySlots[10], arrayCoord); break;
+	case 27: texel = texture(u_ArraySlots[11], arrayCoord); break;
+	case 28: texel = texture(u_ArraySlots[12], arrayCoord); break;
+	case 29: texel = texture(u_ArraySlots[13], arrayCoord); break;
+	case 30: texel = texture(u_ArraySlots[14], arrayCoord); break;
+	case 31: texel = texture(u_ArraySlots[15], arrayCoord); break;
+	}
+
+	if (v_TexSdf == 1)
+	{
+		// Signed distance to the glyph's outline in alpha, 0.5 being on it
+		float width = fwidth(texel.a);
+		o_Color.a *= smoothstep(0.5 - width, 0.5 + width, texel.a);
 	}
+	else
+	{
+		o_Color *= texel;
+	}
+
+	if (o_Color.a == 0.0) discard;
 }
@@ -0,0 +1,167 @@
+#type vertex
+#version 450 core
+
+// Per instance (one instance per quad)
+layout(location = 0) in vec3 a_Position;
+layout(location = 1) in vec4 a_Transform;
+layout(location = 2) in vec4 a_Color;
+layout(location = 3) in vec4 a_TexRect;
+layout(location = 4) in vec4 a_TexTiling;
+layout(location = 5) in uint a_TexFlags;
+
+// Must match QuadFlags in Renderer2D.cpp
+#define NO_TEXTURE  0xFFu
+#define SLOT_MASK   0xFFu
+#define LAYER_SHIFT 8
+#define LAYER_MASK  0xFFFu
+#define FLIP_X      (1u << 24)
+#define FLIP_Y      (1u << 25)
+#define REPEAT      (1u << 26)
+#define SDF         (1u << 28)
+
+uniform mat4 u_ViewProjMatrix;
+
+flat out vec4 v_Color;
+flat out int v_TexSlot;
+flat out int v_TexLayer;
+flat out vec4 v_TexRegion;
+flat out int v_TexRepeat;
+flat out int v_TexSdf;
+out vec2 v_TexCoord;
+
+void main()
+{
+	// Drawn as a 4 vertex triangle strip: (-0.5, -0.5), (0.5, -0.5), (-0.5, 0.5), (0.5, 0.5)
+	vec2 corner = vec2(float(gl_VertexID & 1), float(gl_VertexID >> 1)) - 0.5;
+
+	vec3 position = a_Position;
+	position.xy += a_Transform.xy * corner.x + a_Transform.zw * corner.y;
+	gl_Position = u_ViewProjMatrix * vec4(position, 1.0);
+
+	v_Color = a_Color;
+
+	uint slot = a_TexFlags & SLOT_MASK;
+	v_TexSlot   = slot == NO_TEXTURE ? -1 : int(slot);
+	v_TexLayer  = int((a_TexFlags >> LAYER_SHIFT) & LAYER_MASK);
+	v_TexRepeat = (a_TexFlags & REPEAT) != 0u ? 1 : 0;
+	v_TexSdf    = (a_TexFlags & SDF) != 0u ? 1 : 0;
+
+	// Apply tiling & offset then flipping
+	vec4 coord  = vec4(a_TexRect.xy * a_TexTiling.xy + a_TexTiling.zw, a_TexRect.zw * a_TexTiling.xy);
+	vec4 region = a_TexRect;
+
+	if ((a_TexFlags & FLIP_X) != 0u)
+	{
+		coord.x  += coord.z;  coord.z  = -coord.z;
+		region.x += region.z; region.z = -region.z;
+	}
+
+	if ((a_TexFlags & FLIP_Y) != 0u)
+	{
+		coord.y  += coord.w;  coord.w  = -coord.w;
+		region.y += region.w; region.w = -region.w;
+	}
+
+	v_TexRegion = region;
+	v_TexCoord  = coord.xy + vec2(corner.x + 0.5, 0.5 - corner.y) * coord.zw;
+}
+
+#type fragment
+#version 450 core
+#pragma precision highp float
+
+layout(location = 0) out vec4 o_Color;
+
+flat in vec4 v_Color;
+flat in int v_TexSlot;
+flat in int v_TexLayer;
+flat in vec4 v_TexRegion;
+flat in int v_TexRepeat;
+flat in int v_TexSdf;
+in vec2 v_TexCoord;
+
+// Slots [0, 16) are textures, [16, 32) are texture arrays
+uniform sampler2D[16] u_Slots;
+uniform sampler2DArray[16] u_ArraySlots;
+
+#define EPSILON1 (0.0000000000001)
+#define EPSILON2 (0.0001)
+
+vec2 GetTexCoord()
+{
+	vec2 coord = v_TexCoord;
+
+	if (v_TexRepeat == 1)
+	{
+		coord -= v_TexRegion.xy;
+		coord.x = mod(coord.x, v_TexRegion.z);
+		coord.y = mod(coord.y, v_TexRegion.w);
+		coord += v_TexRegion.xy;
+		if (coord.x < v_TexRegion.x + EPSILON1)
+			coord.x += EPSILON2;
+		if (coord.y < v_TexRegion.y + EPSILON1)
+			coord.y += EPSILON2;
+	}
+
+	return coord;
+}
+
+void main()
+{
+	o_Color = v_Color;
+	if (v_TexSlot < 0)
+		return;
+
+	vec2 coord = GetTexCoord();
+	vec3 arrayCoord = vec3(coord, float(v_TexLayer));
+
+	vec4 texel = vec4(1.0);
+	switch (v_TexSlot)
+	{
+	case  0: texel = texture(u_Slots[0 ], coord); break;
+	case  1: texel = texture(u_Slots[1 ], coord); break;
+	case  2: texel = texture(u_Slots[2 ], coord); break;
+	case  3: texel = texture(u_Slots[3 ], coord); break;
+	case  4: texel = texture(u_Slots[4 ], coord); break;
+	case  5: texel = texture(u_Slots[5 ], coord); break;
+	case  6: texel = texture(u_Slots[6 ], coord); break;
+	case  7: texel = texture(u_Slots[7 ], coord); break;
+	case  8: texel = texture(u_Slots[8 ], coord); break;
+	case  9: texel = texture(u_Slots[9 ], coord); break;
+	case 10: texel = texture(u_Slots[10], coord); break;
+	case 11: texel = texture(u_Slots[11], coord); break;
+	case 12: texel = texture(u_Slots[12], coord); break;
+	case 13: texel = texture(u_Slots[13], coord); break;
+	case 14: texel = texture(u_Slots[14], coord); break;
+	case 15: texel = texture(u_Slots[15], coord); break;
+	case 16: texel = texture(u_ArraySlots[0 ], arrayCoord); break;
+	case 17: texel = texture(u_ArraySlots[1 ], arrayCoord); break;
+	case 18: texel = texture(u_ArraySlots[2 ], arrayCoord); break;
+	case 19: texel = texture(u_ArraySlots[3 ], arrayCoord); break;
+	case 20: texel = texture(u_ArraySlots[4 ], arrayCoord); break;
+	case 21: texel = texture(u_ArraySlots[5 ], arrayCoord); break;
+	case 22: texel = texture(u_ArraySlots[6 ], arrayCoord); break;
+	case 23: texel = texture(u_ArraySlots[7 ], arrayCoord); break;
+	case 24: texel = texture(u_ArraySlots[8 ], arrayCoord); break;
+	case 25: texel = texture(u_ArraySlots[9 ], arrayCoord); break;
+	case 26: texel = texture(u_ArraySlots[10], arrayCoord); break;
+	case 27: texel = texture(u_ArraySlots[11], arrayCoord); break;
+	case 28: texel = texture(u_ArraySlots[12], arrayCoord); break;
+	case 29: texel = texture(u_ArraySlots[13], arrayCoord); break;
+	case 30: texel = texture(u_ArraySlots[14], arrayCoord); break;
+	case 31: texel = texture(u_ArraySlots[15], arrayCoord); break;
+	}
+
+	if (v_TexSdf == 1)
+	{
+		// Signed distance to the glyph's outline in alpha, 0.5 being on it
+		float width = fwidth(texel.a);
+		o_Color.a *= smoothstep(0.5 - width, 0.5 + width, texel.a);
+	}
+	else
+	{
+		o_Color *= texel;
+	}
+
+	if (o_Color.a == 0.0) discard;
+}
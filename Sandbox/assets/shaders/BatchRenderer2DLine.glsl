@@ -0,0 +1,27 @@
+#type vertex
+#version 450 core
+
+layout(location = 0) in vec3 a_Position;
+layout(location = 1) in vec4 a_Color;
+
+uniform mat4 u_ViewProjMatrix;
+
+out vec4 v_Color;
+
+void main()
+{
+	gl_Position = u_ViewProjMatrix * vec4(a_Position, 1.0);
+	v_Color = a_Color;
+}
+
+#type fragment
+#version 450 core
+
+layout(location = 0) out vec4 o_Color;
+
+in vec4 v_Color;
+
+void main()
+{
+	o_Color = v_Color;
+}
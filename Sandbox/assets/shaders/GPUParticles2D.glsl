@@ -0,0 +1,69 @@
+#type vertex
+#version 450 core
+
+// Must match Particle in GPUParticleSystem2D
+struct Particle
+{
+	vec3 Position;
+	float Rotation;
+	vec2 Velocity;
+	float AngularVelocity;
+	float LifeLeft;
+	vec2 BirthSize;
+	vec2 DeathSize;
+	float LifeTime;
+	uint BirthColor;
+	uint DeathColor;
+	uint Padding;
+};
+
+layout(std430, binding = 0) readonly buffer Particles { Particle u_Particles[]; };
+layout(std430, binding = 2) readonly buffer AliveList { uint u_Alive[]; };
+
+uniform mat4 u_ViewProjMatrix;
+
+// Texture coordinates of the quad's top left corner and its size
+uniform vec4 u_TexCoordRect;
+
+out vec4 v_Color;
+out vec2 v_TexCoord;
+
+void main()
+{
+	// One instance per alive particle, drawn as a 4 vertex triangle strip: (-0.5, -0.5), (0.5, -0.5), (-0.5, 0.5), (0.5, 0.5)
+	Particle particle = u_Particles[u_Alive[gl_InstanceID]];
+	vec2 corner = vec2(float(gl_VertexID & 1), float(gl_VertexID >> 1)) - 0.5;
+
+	float life = particle.LifeLeft / particle.LifeTime; // 1 = New, 0 = Old
+	vec2 size = mix(particle.DeathSize, particle.BirthSize, life);
+
+	float c = cos(particle.Rotation);
+	float s = sin(particle.Rotation);
+	vec2 offset = corner * size;
+	offset = vec2(c * offset.x - s * offset.y, s * offset.x + c * offset.y);
+
+	gl_Position = u_ViewProjMatrix * vec4(particle.Position.xy + offset, particle.Position.z, 1.0);
+
+	v_Color = mix(unpackUnorm4x8(particle.DeathColor), unpackUnorm4x8(particle.BirthColor), life);
+	v_TexCoord = u_TexCoordRect.xy + vec2(corner.x + 0.5, 0.5 - corner.y) * u_TexCoordRect.zw;
+}
+
+#type fragment
+#version 450 core
+
+layout(location = 0) out vec4 o_Color;
+
+in vec4 v_Color;
+in vec2 v_TexCoord;
+
+uniform sampler2D u_Sprite;
+uniform int u_HasSprite;
+
+void main()
+{
+	o_Color = v_Color;
+	if (u_HasSprite == 1)
+		o_Color *= texture(u_Sprite, v_TexCoord);
+
+	if (o_Color.a == 0.0) discard;
+}
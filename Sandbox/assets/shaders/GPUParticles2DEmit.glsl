@@ -0,0 +1,102 @@
+#type compute
+#version 450 core
+
+// Must match WorkGroupSize, Particle and EmitRequest in GPUParticleSystem2D
+layout(local_size_x = 256) in;
+
+struct Particle
+{
+	vec3 Position;
+	float Rotation;
+	vec2 Velocity;
+	float AngularVelocity;
+	float LifeLeft;
+	vec2 BirthSize;
+	vec2 DeathSize;
+	float LifeTime;
+	uint BirthColor;
+	uint DeathColor;
+	uint Padding;
+};
+
+struct EmitRequest
+{
+	vec3 Position;
+	float Rotation;
+	vec2 Velocity;
+	vec2 VelocityVariation;
+	float AngularVelocity;
+	float AngularVelocityVariation;
+	float LifeTime;
+	uint First;
+	vec2 BirthSize;
+	vec2 DeathSize;
+	uint BirthColor;
+	uint DeathColor;
+	uint Count;
+	uint Padding;
+};
+
+layout(std430, binding = 0) writeonly buffer Particles { Particle u_Particles[]; };
+layout(std430, binding = 1) readonly buffer Requests { EmitRequest u_Requests[]; };
+
+uniform int u_RequestCount;
+uniform int u_EmitCount;
+uniform int u_EmitSkip;
+uniform int u_EmitStart;
+uniform int u_PoolSize;
+uniform int u_Seed;
+
+// PCG hash
+uint Hash(uint value)
+{
+	uint state = value * 747796405u + 2891336453u;
+	uint word = ((state >> ((state >> 28u) + 4u)) ^ state) * 277803737u;
+	return (word >> 22u) ^ word;
+}
+
+// In [-1, 1]
+float RandomSigned(inout uint state)
+{
+	state = Hash(state);
+	return float(state) / 4294967295.0 * 2.0 - 1.0;
+}
+
+void main()
+{
+	uint id = gl_GlobalInvocationID.x;
+	if (id >= uint(u_EmitCount))
+		return;
+
+	uint emission = id + uint(u_EmitSkip);
+
+	// Last request starting at or before this emission
+	int low = 0;
+	int high = u_RequestCount - 1;
+	while (low < high)
+	{
+		int mid = (low + high + 1) / 2;
+		if (u_Requests[mid].First <= emission)
+			low = mid;
+		else
+			high = mid - 1;
+	}
+
+	EmitRequest request = u_Requests[low];
+	uint random = Hash(uint(u_Seed) ^ Hash(emission));
+
+	Particle particle;
+	particle.Position = request.Position;
+	particle.Rotation = request.Rotation;
+	particle.Velocity = request.Velocity + request.VelocityVariation * vec2(RandomSigned(random), RandomSigned(random));
+	particle.AngularVelocity = request.AngularVelocity + request.AngularVelocityVariation * RandomSigned(random);
+	particle.LifeLeft = request.LifeTime;
+	particle.BirthSize = request.BirthSize;
+	particle.DeathSize = request.DeathSize;
+	particle.LifeTime = request.LifeTime;
+	particle.BirthColor = request.BirthColor;
+	particle.DeathColor = request.DeathColor;
+	particle.Padding = 0u;
+
+	u_Particles[(uint(u_EmitStart) + emission) % uint(u_PoolSize)] = particle;
+}
@@ -0,0 +1,80 @@
+#type compute
+#version 450 core
+
+// Must match WorkGroupSize and Particle in GPUParticleSystem2D
+layout(local_size_x = 256) in;
+
+struct Particle
+{
+	vec3 Position;
+	float Rotation;
+	vec2 Velocity;
+	float AngularVelocity;
+	float LifeLeft;
+	vec2 BirthSize;
+	vec2 DeathSize;
+	float LifeTime;
+	uint BirthColor;
+	uint DeathColor;
+	uint Padding;
+};
+
+layout(std430, binding = 0) buffer Particles { Particle u_Particles[]; };
+layout(std430, binding = 2) writeonly buffer AliveList { uint u_Alive[]; };
+
+// Arguments of the indirect draw, InstanceCount is reset to 0 before this pass
+layout(std430, binding = 3) buffer DrawCommand
+{
+	uint VertexCount;
+	uint InstanceCount;
+	uint FirstVertex;
+	uint BaseInstance;
+} u_DrawCommand;
+
+uniform int u_PoolSize;
+uniform float u_DeltaTime;
+
+// Alive particles are counted per work group first, so there's one global atomic per group
+shared uint s_AliveCount;
+shared uint s_AliveBase;
+
+void main()
+{
+	uint id = gl_GlobalInvocationID.x;
+
+	if (gl_LocalInvocationIndex == 0u)
+		s_AliveCount = 0u;
+	barrier();
+
+	bool alive = false;
+	uint localIndex = 0u;
+
+	if (id < uint(u_PoolSize) && u_Particles[id].LifeLeft > 0.0)
+	{
+		Particle particle = u_Particles[id];
+
+		particle.LifeLeft -= u_DeltaTime;
+		if (particle.LifeLeft > 0.0)
+		{
+			particle.Position.xy += particle.Velocity * u_DeltaTime;
+			particle.Rotation += particle.AngularVelocity * u_DeltaTime;
+
+			alive = true;
+			localIndex = atomicAdd(s_AliveCount, 1u);
+		}
+		else
+		{
+			particle.LifeLeft = 0.0;
+		}
+
+		u_Particles[id] = particle;
+	}
+
+	barrier();
+	if (gl_LocalInvocationIndex == 0u)
+		s_AliveBase = atomicAdd(u_DrawCommand.InstanceCount, s_AliveCount);
+	barrier();
+
+	if (alive)
+		u_Alive[s_AliveBase + localIndex] = id;
+}
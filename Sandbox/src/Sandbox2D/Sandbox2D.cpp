@@ -154,10 +154,11 @@ void Sandbox2D::OnImGuiRender()
 	sprintf(fps, "%f", s_FPSSamples[(int)s_FPSSamples.size() - 1]);
 	ImGui::PlotLines("FPS", s_FPSSamples.data(), (int)s_FPSSamples.size(), 0, fps, FLT_MAX, FLT_MAX, ImVec2{ 0, 80 });
 
-	ImGui::Text("DrawCalls : %i", Renderer2D::GetStatistics().DrawCalls);
-	ImGui::Text("QuadCount : %i", Renderer2D::GetStatistics().QuadCount);
-	ImGui::Text("IndexCount : %i", Renderer2D::GetStatistics().GetIndexCount());
-	ImGui::Text("VertexCount : %i", Renderer2D::GetStatistics().GetVertexCount());
+	auto stats = Renderer2D::GetStatistics();
+	ImGui::Text("DrawCalls : %i", stats.DrawCalls);
+	ImGui::Text("QuadCount : %i", stats.QuadCount);
+	ImGui::Text("VertexCount : %i", stats.VertexCount);
+	ImGui::Text("GPU Time : %.3f ms", stats.GPUTime);
 
 	ImGui::End();
 }
@@ -49,6 +49,19 @@ SandboxECS::SandboxECS()
 			props.Density = 1.0f;
 			playerColliderList.Colliders.push_back(Collider2D::Create(props));
 		}
+
+		// Trail, a bit behind the player
+		{
+			Entity trail = m_Scene->CreateEntity(m_Player, "Trail");
+			trail.GetComponent<TransformComponent>().SetLocalPosition({ 0.0f, 0.0f, -0.2f });
+
+			auto& emitter = trail.AddComponent<ParticleEmitter2DComponent>(m_Sprite);
+			emitter.EmissionRate = 120.0f;
+			emitter.BirthSize = Vector2(0.2f);
+			emitter.DeathSize = Vector2(1.0f);
+			emitter.BirthColor = Color(0.8f, 0.8f, 0.8f, 1.0f);
+			emitter.DeathColor = Color(0.0f);
+		}
 	}
 
 	////////////////////////////////////////////////////////////////
@@ -141,11 +154,6 @@ SandboxECS::SandboxECS()
 	{
 	public:
 
-		Player(ParticleSystem2D* particleSystem)
-			: m_ParticleSystem(particleSystem)
-		{
-		}
-
 		virtual void OnUpdate(TimeStep ts) override
 		{
 			Vector2 vel(0.0f);
@@ -162,25 +170,7 @@ SandboxECS::SandboxECS()
 
 			auto& rb = GetComponent<RigidBody2DComponent>().RigidBody;
 			rb->ApplyLinearImpulseToCenter(vel);
-
-			m_ParticleProps.Position = GetComponent<TransformComponent>().GetPosition();
-			m_ParticleProps.Position.z = -0.2f;
-
-			m_ParticleProps.Position.x += Random::Range(-0.2f, 0.2f);
-			m_ParticleProps.Position.y += Random::Range(-0.2f, 0.2f);
-
-			m_ParticleProps.BirthSize = Vector2(0.2f);
-
-			m_ParticleProps.RenderingProps.Sprite = GetComponent<SpriteRendererComponent>().Sprite;
-			m_ParticleProps.RenderingProps.BirthColor = Color(0.8f, 0.8f, 0.8f, 1.0f);
-
-			OE_SIMPLE_FOR_LOOP(2) m_ParticleSystem->Emit(m_ParticleProps);
 		}
-
-	private:
-		ParticleSystem2D* m_ParticleSystem;
-
-		Particle2DProps m_ParticleProps = Particle2DProps();
 	};
 
 	class CameraController : public ScriptableEntity
@@ -204,7 +194,7 @@ SandboxECS::SandboxECS()
 		Entity m_PlayerEntity;
 	};
 
-	m_Player.AddComponent<NativeScriptsComponent>().AddScript<Player>(&m_ParticleSystem);
+	m_Player.AddComponent<NativeScriptsComponent>().AddScript<Player>();
 	m_MainCamera.AddComponent<NativeScriptsComponent>().AddScript<CameraController>(m_Player);
 
 	m_Scene->OnScenePlay();
@@ -231,7 +221,6 @@ void SandboxECS::OnUpdate(TimeStep deltaTime)
 	m_Scene->SetViewportSize(win.GetWidth(), win.GetHeight());
 
 	m_Scene->OnUpdate(deltaTime);
-	m_ParticleSystem.UpdateAndRender(deltaTime, glm::inverse(camTransform.GetLocalToWorld()), m_MainCamera.GetComponent<CameraComponent>().Camera);
 }
 
 void SandboxECS::OnImGuiRender()
@@ -253,7 +242,7 @@ void SandboxECS::OnImGuiRender()
 	ImGui::Text("MaxFPS : %i   ", s_MaxFPS);
 
 	if (ImGui::Button("Reload Renderer2D Shader"))
-		Renderer2D::GetShader()->Reload();
+		RenderCommand::Submit([]() { Renderer2D::GetShader()->Reload(); });
 
 	ImGui::SameLine();
 
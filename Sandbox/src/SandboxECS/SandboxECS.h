@@ -24,6 +24,4 @@ private:
 	Ref<Scene> m_Scene;
 	Entity m_Player;
 	Entity m_MainCamera;
-
-	ParticleSystem2D m_ParticleSystem;
 };